@@ -0,0 +1,208 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the traits used to fill the containers in the most efficient way they support
+ */
+
+#pragma once
+
+// Cedar Framework includes
+
+// Qt includes
+#include <QtCore/QtGlobal>
+
+// System includes
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+//! Helper for VoidType
+template<typename... T>
+struct MakeVoid
+{
+    //! Type
+    using type = void;
+};
+
+//! Maps any types to void, used to detect the methods of a container
+template<typename... T>
+using VoidType = typename MakeVoid<T...>::type;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if the container has a reserve() method
+ *
+ * \tparam  C   Container type
+ */
+template<typename C, typename = void>
+struct HasReserve : std::false_type
+{
+};
+
+//! \copydoc    CedarFramework::Internal::HasReserve
+template<typename C>
+struct HasReserve<C, VoidType<decltype(std::declval<C &>().reserve(0))>> : std::true_type
+{
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if a default constructed item can be appended to the container with emplace_back() and
+ * then accessed by reference with back()
+ *
+ * \tparam  C   Container type
+ *
+ * \note    This is not the case for std::vector<bool> because back() returns a proxy object
+ */
+template<typename C, typename = void>
+struct HasEmplaceBack : std::false_type
+{
+};
+
+//! \copydoc    CedarFramework::Internal::HasEmplaceBack
+template<typename C>
+struct HasEmplaceBack<
+        C,
+        VoidType<decltype(std::declval<C &>().emplace_back()),
+                 std::enable_if_t<std::is_same<decltype(std::declval<C &>().back()),
+                                               typename C::value_type &>::value>>>
+    : std::true_type
+{
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if the container can be resized with resize() and its items then accessed by reference
+ * with operator[]
+ *
+ * \tparam  C   Container type
+ *
+ * \note    This is not the case for std::vector<bool> because operator[] returns a proxy object
+ */
+template<typename C, typename = void>
+struct HasIndexedResize : std::false_type
+{
+};
+
+//! \copydoc    CedarFramework::Internal::HasIndexedResize
+template<typename C>
+struct HasIndexedResize<
+        C,
+        VoidType<decltype(std::declval<C &>().resize(0)),
+                 std::enable_if_t<std::is_same<decltype(std::declval<C &>()[0]),
+                                               typename C::value_type &>::value>>>
+    : std::true_type
+{
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Reserves space for the items in the container if it supports it
+ *
+ * \tparam  C   Container type
+ *
+ * \param   container   Container
+ * \param   size        Number of items
+ */
+template<typename C>
+void reserveItems(C *container, const int size, std::true_type)
+{
+    container->reserve(static_cast<typename C::size_type>(size));
+}
+
+//! \copydoc    CedarFramework::Internal::reserveItems()
+template<typename C>
+void reserveItems(C *container, const int size, std::false_type)
+{
+    Q_UNUSED(container);
+    Q_UNUSED(size);
+}
+
+//! \copydoc    CedarFramework::Internal::reserveItems()
+template<typename C>
+void reserveItems(C *container, const int size)
+{
+    reserveItems(container, size, HasReserve<C>());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Creates an item for the container
+ *
+ * \tparam  T   Item type
+ * \tparam  C   Container type
+ *
+ * \param   container   Container
+ *
+ * \return  Created item
+ *
+ * \note    If the container has an allocator that the item can use (for example a
+ *          std::pmr::polymorphic_allocator) the item is created with it, so that the nested
+ *          containers are allocated from the same memory resource as the container
+ */
+template<typename T, typename C, typename = void>
+struct ItemFactory
+{
+    //! \copydoc    CedarFramework::Internal::ItemFactory
+    static T create(const C &container)
+    {
+        Q_UNUSED(container);
+        return T();
+    }
+};
+
+//! \copydoc    CedarFramework::Internal::ItemFactory
+template<typename T, typename C>
+struct ItemFactory<
+        T,
+        C,
+        std::enable_if_t<std::uses_allocator<T, typename C::allocator_type>::value>>
+{
+    //! \copydoc    CedarFramework::Internal::ItemFactory
+    static T create(const C &container)
+    {
+        return T(container.get_allocator());
+    }
+};
+
+//! \copydoc    CedarFramework::Internal::ItemFactory
+template<typename T, typename C>
+T createItem(const C &container)
+{
+    return ItemFactory<T, C>::create(container);
+}
+
+} // namespace Internal
+
+} // namespace CedarFramework
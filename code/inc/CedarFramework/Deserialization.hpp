@@ -21,21 +21,51 @@
 #pragma once
 
 // Cedar Framework includes
+#include <CedarFramework/ContainerTraits.hpp>
+#include <CedarFramework/DeserializationError.hpp>
+#include <CedarFramework/Encoding.hpp>
+#include <CedarFramework/Interning.hpp>
 #include <CedarFramework/Query.hpp>
+#include <CedarFramework/TypeTag.hpp>
 
 // Qt includes
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonValue>
 #include <QtCore/QMap>
+#include <QtCore/QVarLengthArray>
 
 // System includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <set>
 #include <unordered_map>
+#include <unordered_set>
+
+#if (__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))
+#if __has_include(<memory_resource>)
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <vector>
+#endif
+#endif
 
 // Forward declarations
 
 // Macros
 
+#if (__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))
+#if __has_include(<memory_resource>)
+//! Defined if the std::pmr containers are available (C++17)
+#define CEDARFRAMEWORK_HAS_STD_PMR
+#endif
+#endif
+
 // -------------------------------------------------------------------------------------------------
 
 namespace CedarFramework
@@ -252,6 +282,61 @@ template<>
 CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &json, QCborSimpleType *value);
 #endif
 
+/*!
+ * Deserializes the value of a trivial type
+ *
+ * \param       json    JSON value to deserialize
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    These inline overloads are preferred over the exported specializations (for example for
+ *          the items of the containers) so that the common case can be inlined. Any other input is
+ *          passed on to the exported specializations so the result and the reported errors are the
+ *          same.
+ */
+inline bool deserialize(const QJsonValue &json, bool *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, signed char *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, unsigned char *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, short *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, unsigned short *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, int *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, unsigned int *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, long *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, unsigned long *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, long long *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, unsigned long long *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, float *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, double *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, bool *)
+inline bool deserialize(const QJsonValue &json, QString *value);
+
 //! \copydoc    CedarFramework::serialize()
 template<typename T1, typename T2>
 bool deserialize(const QJsonValue &json, QPair<T1, T2> *value);
@@ -280,6 +365,26 @@ bool deserialize(const QJsonValue &json, std::vector<T> *value);
 template<typename T>
 bool deserialize(const QJsonValue &json, QSet<T> *value);
 
+//! \copydoc    CedarFramework::serialize()
+template<typename T, int Prealloc>
+bool deserialize(const QJsonValue &json, QVarLengthArray<T, Prealloc> *value);
+
+//! \copydoc    CedarFramework::serialize()
+template<typename T>
+bool deserialize(const QJsonValue &json, std::deque<T> *value);
+
+//! \copydoc    CedarFramework::serialize()
+template<typename T, std::size_t N>
+bool deserialize(const QJsonValue &json, std::array<T, N> *value);
+
+//! \copydoc    CedarFramework::serialize()
+template<typename T>
+bool deserialize(const QJsonValue &json, std::set<T> *value);
+
+//! \copydoc    CedarFramework::serialize()
+template<typename T>
+bool deserialize(const QJsonValue &json, std::unordered_set<T> *value);
+
 //! \copydoc    CedarFramework::serialize()
 template<typename K, typename V>
 bool deserialize(const QJsonValue &json, QMap<K, V> *value);
@@ -304,6 +409,83 @@ bool deserialize(const QJsonValue &json, QMultiMap<K, V> *value);
 template<typename K, typename V>
 bool deserialize(const QJsonValue &json, QMultiHash<K, V> *value);
 
+/*!
+ * Deserializes the polymorphic value by creating the derived type selected by the type tag
+ *
+ * \tparam  T   Base type
+ *
+ * \param       json    JSON value (*JSON Object* with "type" and "value" members or *JSON Null*
+ *                      for a null pointer)
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    The derived type needs to be registered with registerPolymorphicType()
+ */
+template<typename T>
+bool deserialize(const QJsonValue &json, std::unique_ptr<T> *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, std::unique_ptr<T> *)
+template<typename T>
+bool deserialize(const QJsonValue &json, std::shared_ptr<T> *value);
+
+#ifdef CEDARFRAMEWORK_HAS_STD_VARIANT
+/*!
+ * Deserializes the std::variant value directly to the alternative selected by the type tag
+ *
+ * \tparam  T   Alternative types
+ *
+ * \param       json    JSON value (*JSON Object* with "type" and "value" members)
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    Type tags of all alternatives need to be declared with CEDARFRAMEWORK_TYPE_TAG()
+ */
+template<typename... T>
+bool deserialize(const QJsonValue &json, std::variant<T...> *value);
+#endif
+
+#ifdef CEDARFRAMEWORK_HAS_STD_PMR
+/*!
+ * Deserializes the value to a container that allocates from a memory resource
+ *
+ * \tparam  T   Item type
+ *
+ * \param       json    JSON value to deserialize
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    The items are created with the allocator of the container, so the items and their own
+ *          std::pmr containers are allocated from the memory resource of the container too
+ */
+template<typename T>
+bool deserialize(const QJsonValue &json, std::pmr::vector<T> *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, std::pmr::vector<T> *)
+template<typename K, typename V>
+bool deserialize(const QJsonValue &json, std::pmr::map<K, V> *value);
+
+//! \copydoc    CedarFramework::deserialize(const QJsonValue &, std::pmr::vector<T> *)
+template<typename K, typename V>
+bool deserialize(const QJsonValue &json, std::pmr::unordered_map<K, V> *value);
+
+/*!
+ * Deserializes the value to a string that allocates from a memory resource
+ *
+ * \param       json    JSON value to deserialize
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+inline bool deserialize(const QJsonValue &json, std::pmr::string *value);
+#endif
+
 /*!
  * Helper method for that deserializes the key value from a key (string) in a JSON object
  *
@@ -319,6 +501,63 @@ bool deserialize(const QJsonValue &json, QMultiHash<K, V> *value);
 template<typename T>
 bool deserializeKey(const QString &value, T *key);
 
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, signed char *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, unsigned char *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, short *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, unsigned short *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, int *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, unsigned int *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, long *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, unsigned long *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, long long *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, unsigned long long *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, QString *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, std::string *key);
+
+//! \copydoc    CedarFramework::deserializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT bool deserializeKey(const QString &value, QUuid *key);
+
+#ifdef CEDARFRAMEWORK_HAS_STD_PMR
+//! \copydoc    CedarFramework::deserializeKey()
+inline bool deserializeKey(const QString &value, std::pmr::string *key);
+#endif
+
 /*!
  * Deserializes the sub-node at the specified index
  *
@@ -396,6 +635,9 @@ bool deserializeNode(const QJsonValue &data, const QStringList &nodePath, T *val
  *
  * \retval  true    Success (node was found and deserialied, or node was not found)
  * \retval  true    Failure
+ *
+ * \note    If the node is not found while the storage is reused (see deserializeInto()) the value
+ *          is reset to a value-initialized value so that it doesn't keep a stale value
  */
 template<typename T>
 bool deserializeOptionalNode(const QJsonValue &data,
@@ -416,6 +658,9 @@ bool deserializeOptionalNode(const QJsonValue &data,
  *
  * \retval  true    Success
  * \retval  true    Failure
+ *
+ * \note    If the node is not found while the storage is reused (see deserializeInto()) the value
+ *          is reset to a value-initialized value so that it doesn't keep a stale value
  */
 template<typename T>
 bool deserializeOptionalNode(const QJsonValue &data,
@@ -436,6 +681,9 @@ bool deserializeOptionalNode(const QJsonValue &data,
  *
  * \retval  true    Success
  * \retval  true    Failure
+ *
+ * \note    If the node is not found while the storage is reused (see deserializeInto()) the value
+ *          is reset to a value-initialized value so that it doesn't keep a stale value
  */
 template<typename T>
 bool deserializeOptionalNode(const QJsonValue &data,
@@ -456,6 +704,9 @@ bool deserializeOptionalNode(const QJsonValue &data,
  *
  * \retval  true    Success
  * \retval  true    Failure
+ *
+ * \note    If the node is not found while the storage is reused (see deserializeInto()) the value
+ *          is reset to a value-initialized value so that it doesn't keep a stale value
  */
 template<typename T>
 bool deserializeOptionalNode(const QJsonValue &data,
@@ -463,128 +714,596 @@ bool deserializeOptionalNode(const QJsonValue &data,
                              T *value,
                              bool *deserialized = nullptr);
 
-// -------------------------------------------------------------------------------------------------
-// Template definitions
-// -------------------------------------------------------------------------------------------------
+/*!
+ * Deserializes the value with the specified encoding profile
+ *
+ * \tparam  T   Value type
+ *
+ * \param   json    JSON value to deserialize
+ * \param   profile Encoding profile to use
+ *
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T>
+bool deserialize(const QJsonValue &json, T *value, const EncodingProfile &profile);
 
-template<typename T1, typename T2>
-bool deserialize(const QJsonValue &json, QPair<T1, T2> *value)
+/*!
+ * Deserializes the value into an existing value and reuses the storage that it already allocated
+ *
+ * \tparam  T   Value type
+ *
+ * \param       json    JSON value to deserialize
+ * \param[out]  value   Existing value to deserialize into
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    The items of vectors, deques and arrays are overwritten in place and the items of maps
+ *          are updated in place as long as the keys of the map stay the same, so the storage of the
+ *          items (for example their nested containers) is reused too. Other values are deserialized
+ *          the same as with deserialize(). In case of a failure the value can be partially
+ *          overwritten.
+ *
+ * \warning The reused values are deserialized in place, so the members that are missing in the JSON
+ *          value must not keep their previous values. The optional nodes (deserializeOptionalNode()
+ *          and FieldBinder::bindOptional()) and the properties of Q_GADGET and QObject types are
+ *          reset to value-initialized values if they are missing, custom deserialization functions
+ *          that skip missing members need to do the same (see isStorageReuseEnabled()).
+ */
+template<typename T>
+bool deserializeInto(const QJsonValue &json, T *value);
+
+namespace Internal
 {
-    Q_ASSERT(value != nullptr);
 
-    // Get the JSON Object representation
-    if (!json.isObject())
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("JSON value is not an Object");
-        return false;
-    }
+/*!
+ * Encodes the string to UTF-8 directly into the output buffer
+ *
+ * \param       value   String to encode
+ * \param[out]  output  Output buffer or a null pointer to only calculate the size of the encoded
+ *                      string
+ *
+ * \return  Size of the encoded string in bytes
+ *
+ * \note    An unpaired surrogate is encoded as '?', the same as with QString::toUtf8()
+ */
+CEDARFRAMEWORK_EXPORT std::size_t encodeUtf8(const QString &value, char *output);
 
-    const auto jsonObject = json.toObject();
+/*!
+ * Checks if the storage of the deserialized values is reused in the current thread
+ *
+ * \retval  true    Storage is reused
+ * \retval  false   Storage is not reused
+ */
+CEDARFRAMEWORK_EXPORT bool isStorageReuseEnabled();
 
-    if (jsonObject.size() != 2)
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("A pair needs to have exactly two members but this one has:")
-                << jsonObject.size();
-        return false;
-    }
+//! Enables the reuse of the storage of the deserialized values in the current thread for the
+//! lifetime of the object
+class CEDARFRAMEWORK_EXPORT StorageReuseScope
+{
+public:
+    //! Constructor
+    StorageReuseScope();
 
-    // Deserialize members
-    if (!deserialize(jsonObject.value(QStringLiteral("first")), &value->first))
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("Failed to deserialize the member 'first' of a pair item");
-        return false;
-    }
+    //! Destructor, restores the previous state
+    ~StorageReuseScope();
 
-    if (!deserialize(jsonObject.value(QStringLiteral("second")), &value->second))
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("Failed to deserialize the member 'second' of a pair item");
-        return false;
-    }
+    //! Copy constructor is disabled
+    StorageReuseScope(const StorageReuseScope &) = delete;
 
-    return true;
-}
+    //! Copy assignment operator is disabled
+    StorageReuseScope &operator=(const StorageReuseScope &) = delete;
 
-// -------------------------------------------------------------------------------------------------
+private:
+    //! Previous state
+    bool m_previousState;
+};
 
-template<typename T1, typename T2>
-bool deserialize(const QJsonValue &json, std::pair<T1, T2> *value)
-{
-    Q_ASSERT(value != nullptr);
+/*!
+ * Resets the value to a value-initialized value if the storage is reused
+ *
+ * \tparam  T   Value type
+ *
+ * \param[out]  value   Value to reset
+ *
+ * \note    This is used for the optional values that are missing in the JSON value, otherwise they
+ *          would keep their values from the previous deserialization. Values that can't be
+ *          value-initialized and assigned are left as they are.
+ */
+template<typename T>
+void resetOptionalValue(T *value);
 
-    // Get the JSON Object representation
-    if (!json.isObject())
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("JSON value is not an Object");
-        return false;
-    }
+/*!
+ * Splits the JSON representation of a tagged value to the type tag and the value
+ *
+ * \param       json    JSON value (*JSON Object* with "type" and "value" members)
+ * \param[out]  tag     Output for the type tag
+ * \param[out]  value   Output for the JSON representation of the value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+CEDARFRAMEWORK_EXPORT bool parseTaggedValue(const QJsonValue &json,
+                                             QString *tag,
+                                             QJsonValue *value);
 
-    const auto jsonObject = json.toObject();
+} // namespace Internal
 
-    if (jsonObject.size() != 2)
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("A pair needs to have exactly two members but this one has:")
-                << jsonObject.size();
-        return false;
-    }
+// -------------------------------------------------------------------------------------------------
+// Template definitions
+// -------------------------------------------------------------------------------------------------
 
-    // Deserialize members
-    if (!deserialize(jsonObject.value(QStringLiteral("first")), &value->first))
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("Failed to deserialize the member 'first' of a pair item");
-        return false;
-    }
+namespace Internal
+{
 
-    if (!deserialize(jsonObject.value(QStringLiteral("second")), &value->second))
+//! \copydoc    CedarFramework::Internal::resetOptionalValue()
+template<typename T>
+void resetOptionalValue(T *value, std::true_type)
+{
+    if (isStorageReuseEnabled())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("Failed to deserialize the member 'second' of a pair item");
-        return false;
+        *value = T();
     }
+}
 
-    return true;
+//! \copydoc    CedarFramework::Internal::resetOptionalValue()
+template<typename T>
+void resetOptionalValue(T *value, std::false_type)
+{
+    Q_UNUSED(value);
+}
+
+template<typename T>
+void resetOptionalValue(T *value)
+{
+    resetOptionalValue(value,
+                       std::integral_constant<bool,
+                                              std::is_default_constructible<T>::value &&
+                                              std::is_move_assignable<T>::value>());
 }
 
 // -------------------------------------------------------------------------------------------------
 
+/*!
+ * Deserializes the integer value from a *JSON Number* that is in range of the integer type and
+ * passes on any other input to the exported specialization
+ *
+ * \tparam  T   Integer type
+ *
+ * \param       json    JSON value to deserialize
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
 template<typename T>
-bool deserialize(const QJsonValue &json, QList<T> *value)
+bool deserializeIntegerNumber(const QJsonValue &json, T *value)
 {
     Q_ASSERT(value != nullptr);
 
-    // Get the JSON Array representation
-    if (!json.isArray())
+    if (json.isDouble())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("JSON value is not an Array");
-        return false;
+        constexpr auto lowwerLimit = static_cast<double>(std::numeric_limits<T>::lowest());
+        constexpr auto upperLimit  = static_cast<double>(std::numeric_limits<T>::max());
+        const double doubleValue = json.toDouble();
+
+        if ((lowwerLimit <= doubleValue) && (doubleValue <= upperLimit))
+        {
+            *value = static_cast<T>(std::round(doubleValue));
+            return true;
+        }
     }
 
-    const auto jsonArray = json.toArray();
+    return deserialize<T>(json, value);
+}
 
-    // Deserialize elements
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, bool *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    if (json.isBool())
+    {
+        *value = json.toBool();
+        return true;
+    }
+
+    return deserialize<bool>(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, signed char *value)
+{
+    return Internal::deserializeIntegerNumber(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, unsigned char *value)
+{
+    return Internal::deserializeIntegerNumber(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, short *value)
+{
+    return Internal::deserializeIntegerNumber(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, unsigned short *value)
+{
+    return Internal::deserializeIntegerNumber(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, int *value)
+{
+    return Internal::deserializeIntegerNumber(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, unsigned int *value)
+{
+    return Internal::deserializeIntegerNumber(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, long *value)
+{
+    return Internal::deserializeIntegerNumber(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, unsigned long *value)
+{
+    return Internal::deserializeIntegerNumber(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, long long *value)
+{
+    return Internal::deserializeIntegerNumber(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, unsigned long long *value)
+{
+    return Internal::deserializeIntegerNumber(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, float *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    if (json.isDouble())
+    {
+        constexpr auto limit = static_cast<double>(std::numeric_limits<float>::max());
+        const double doubleValue = json.toDouble();
+
+        if ((-limit <= doubleValue) && (doubleValue <= limit))
+        {
+            *value = static_cast<float>(doubleValue);
+            return true;
+        }
+    }
+
+    return deserialize<float>(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, double *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    if (json.isDouble())
+    {
+        *value = json.toDouble();
+        return true;
+    }
+
+    return deserialize<double>(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, QString *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    // The interned strings are handled by the generic deserialization
+    if (json.isString() && (activeInterningPool() == nullptr))
+    {
+        *value = json.toString();
+        return true;
+    }
+
+    return deserialize<QString>(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+/*!
+ * Deserializes the items of a pair from its JSON Array representation (compact encoding)
+ *
+ * \tparam  T1  Type of the first item
+ * \tparam  T2  Type of the second item
+ *
+ * \param       jsonArray   JSON Array
+ * \param[out]  first       Output for the first item
+ * \param[out]  second      Output for the second item
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T1, typename T2>
+bool deserializeCompactPair(const QJsonArray &jsonArray, T1 *first, T2 *second)
+{
+    if (jsonArray.size() != 2)
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
+                << QStringLiteral("A pair needs to have exactly two items but this one has:")
+                << jsonArray.size();
+        return false;
+    }
+
+    if (!deserialize(jsonArray.at(0), first))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, 0)
+                << QStringLiteral("Failed to deserialize the item 'first' of a pair item");
+        return false;
+    }
+
+    if (!deserialize(jsonArray.at(1), second))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, 1)
+                << QStringLiteral("Failed to deserialize the item 'second' of a pair item");
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T1, typename T2>
+bool deserialize(const QJsonValue &json, QPair<T1, T2> *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    // Get the JSON Array representation (compact encoding)
+    if ((activeEncodingProfile().pair == Encoding::Compact) && json.isArray())
+    {
+        return Internal::deserializeCompactPair(json.toArray(), &value->first, &value->second);
+    }
+
+    // Get the JSON Object representation
+    if (!json.isObject())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not an Object");
+        return false;
+    }
+
+    const auto jsonObject = json.toObject();
+
+    if (jsonObject.size() != 2)
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
+                << QStringLiteral("A pair needs to have exactly two members but this one has:")
+                << jsonObject.size();
+        return false;
+    }
+
+    // Deserialize members
+    if (!deserialize(jsonObject.value(QStringLiteral("first")), &value->first))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("first"))
+                << QStringLiteral("Failed to deserialize the member 'first' of a pair item");
+        return false;
+    }
+
+    if (!deserialize(jsonObject.value(QStringLiteral("second")), &value->second))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("second"))
+                << QStringLiteral("Failed to deserialize the member 'second' of a pair item");
+        return false;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T1, typename T2>
+bool deserialize(const QJsonValue &json, std::pair<T1, T2> *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    // Get the JSON Array representation (compact encoding)
+    if ((activeEncodingProfile().pair == Encoding::Compact) && json.isArray())
+    {
+        return Internal::deserializeCompactPair(json.toArray(), &value->first, &value->second);
+    }
+
+    // Get the JSON Object representation
+    if (!json.isObject())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not an Object");
+        return false;
+    }
+
+    const auto jsonObject = json.toObject();
+
+    if (jsonObject.size() != 2)
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
+                << QStringLiteral("A pair needs to have exactly two members but this one has:")
+                << jsonObject.size();
+        return false;
+    }
+
+    // Deserialize members
+    if (!deserialize(jsonObject.value(QStringLiteral("first")), &value->first))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("first"))
+                << QStringLiteral("Failed to deserialize the member 'first' of a pair item");
+        return false;
+    }
+
+    if (!deserialize(jsonObject.value(QStringLiteral("second")), &value->second))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("second"))
+                << QStringLiteral("Failed to deserialize the member 'second' of a pair item");
+        return false;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+/*!
+ * Deserializes an item and appends it to the sequence container
+ *
+ * \tparam  C   Container type
+ *
+ * \param       json        JSON value of the item
+ * \param[out]  container   Container
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    The item is deserialized in place if the container supports emplace_back(), otherwise it
+ *          is moved into the container
+ */
+template<typename C>
+bool appendItem(const QJsonValue &json, C *container, std::true_type)
+{
+    container->emplace_back();
+    return deserialize(json, &container->back());
+}
+
+//! \copydoc    CedarFramework::Internal::appendItem()
+template<typename C>
+bool appendItem(const QJsonValue &json, C *container, std::false_type)
+{
+    typename C::value_type item;
+
+    if (!deserialize(json, &item))
+    {
+        return false;
+    }
+
+    container->push_back(std::move(item));
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes the items of a sequence container
+ *
+ * \tparam  C   Container type
+ *
+ * \param       jsonArray   JSON Array
+ * \param[out]  value       Output for the deserialized value
+ * \param       itemName    Name of the container items used in the error messages
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    The container is cleared and the items are appended to it
+ */
+template<typename C>
+bool deserializeSequenceItems(const QJsonArray &jsonArray,
+                              C *value,
+                              const char *itemName,
+                              std::false_type)
+{
     value->clear();
-    value->reserve(jsonArray.size());
+    reserveItems(value, jsonArray.size());
     int index = 0;
 
     for (const auto &item : jsonArray)
     {
-        T deserializedItem;
+        if (!appendItem(item, value, HasEmplaceBack<C>()))
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, index)
+                    << QString("Failed to deserialize the %1 element at index:")
+                       .arg(QLatin1String(itemName))
+                    << index;
+            return false;
+        }
 
-        if (!deserialize(item, &deserializedItem))
+        index++;
+    }
+
+    return true;
+}
+
+/*!
+ * \copydoc    CedarFramework::Internal::deserializeSequenceItems()
+ *
+ * \note    If the storage is reused the container is resized and the items that it already holds
+ *          are overwritten in place
+ */
+template<typename C>
+bool deserializeSequenceItems(const QJsonArray &jsonArray,
+                              C *value,
+                              const char *itemName,
+                              std::true_type)
+{
+    if (!isStorageReuseEnabled())
+    {
+        return deserializeSequenceItems(jsonArray, value, itemName, std::false_type());
+    }
+
+    value->resize(static_cast<typename C::size_type>(jsonArray.size()));
+    int index = 0;
+
+    for (const auto &item : jsonArray)
+    {
+        if (!deserialize(item, &(*value)[static_cast<typename C::size_type>(index)]))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the list element at index:") << index;
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, index)
+                    << QString("Failed to deserialize the %1 element at index:")
+                       .arg(QLatin1String(itemName))
+                    << index;
             return false;
         }
 
-        value->append(deserializedItem);
         index++;
     }
 
@@ -593,15 +1312,60 @@ bool deserialize(const QJsonValue &json, QList<T> *value)
 
 // -------------------------------------------------------------------------------------------------
 
-template<typename T>
-bool deserialize(const QJsonValue &json, std::list<T> *value)
+/*!
+ * Deserializes a sequence container
+ *
+ * \tparam  C   Container type
+ *
+ * \param       json        JSON value (*JSON Array*)
+ * \param[out]  value       Output for the deserialized value
+ * \param       itemName    Name of the container items used in the error messages
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename C>
+bool deserializeSequence(const QJsonValue &json, C *value, const char *itemName)
+{
+    Q_ASSERT(value != nullptr);
+
+    // Get the JSON Array representation
+    if (!json.isArray())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not an Array");
+        return false;
+    }
+
+    // Deserialize elements
+    return deserializeSequenceItems(json.toArray(), value, itemName, HasIndexedResize<C>());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes a set container
+ *
+ * \tparam  C   Container type
+ *
+ * \param       json    JSON value (*JSON Array*)
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    Duplicate items are detected with a single lookup by checking if the insertion changed
+ *          the size of the set
+ */
+template<typename C>
+bool deserializeSet(const QJsonValue &json, C *value)
 {
     Q_ASSERT(value != nullptr);
 
     // Get the JSON Array representation
     if (!json.isArray())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not an Array");
         return false;
     }
@@ -610,103 +1374,130 @@ bool deserialize(const QJsonValue &json, std::list<T> *value)
 
     // Deserialize elements
     value->clear();
+    reserveItems(value, jsonArray.size());
     int index = 0;
 
     for (const auto &item : jsonArray)
     {
-        T deserializedItem;
+        typename C::value_type deserializedItem;
 
         if (!deserialize(item, &deserializedItem))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the list element at index:") << index;
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, index)
+                    << QStringLiteral("Failed to deserialize the set element");
+            return false;
+        }
+
+        const auto size = value->size();
+        value->insert(std::move(deserializedItem));
+
+        if (value->size() == size)
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::DuplicateItem, index)
+                    << QStringLiteral("Duplicate set element");
             return false;
         }
 
-        value->push_back(std::move(deserializedItem));
         index++;
     }
 
     return true;
 }
 
+} // namespace Internal
+
 // -------------------------------------------------------------------------------------------------
 
 template<typename T>
-bool deserialize(const QJsonValue &json, QVector<T> *value)
+bool deserialize(const QJsonValue &json, QList<T> *value)
 {
-    Q_ASSERT(value != nullptr);
+    return Internal::deserializeSequence(json, value, "list");
+}
 
-    // Get the JSON Array representation
-    if (!json.isArray())
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("JSON value is not an Array");
-        return false;
-    }
+// -------------------------------------------------------------------------------------------------
 
-    const auto jsonArray = json.toArray();
+template<typename T>
+bool deserialize(const QJsonValue &json, std::list<T> *value)
+{
+    return Internal::deserializeSequence(json, value, "list");
+}
 
-    // Deserialize elements
-    value->clear();
-    value->reserve(jsonArray.size());
-    int index = 0;
+// -------------------------------------------------------------------------------------------------
 
-    for (const auto &item : jsonArray)
-    {
-        T deserializedItem;
+template<typename T>
+bool deserialize(const QJsonValue &json, QVector<T> *value)
+{
+    return Internal::deserializeSequence(json, value, "vector");
+}
 
-        if (!deserialize(item, &deserializedItem))
-        {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the vector element at index:")
-                    << index;
-            return false;
-        }
+// -------------------------------------------------------------------------------------------------
 
-        value->append(deserializedItem);
-        index++;
-    }
+template<typename T>
+bool deserialize(const QJsonValue &json, std::vector<T> *value)
+{
+    return Internal::deserializeSequence(json, value, "vector");
+}
 
-    return true;
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserialize(const QJsonValue &json, QSet<T> *value)
+{
+    return Internal::deserializeSet(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, int Prealloc>
+bool deserialize(const QJsonValue &json, QVarLengthArray<T, Prealloc> *value)
+{
+    return Internal::deserializeSequence(json, value, "array");
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename T>
-bool deserialize(const QJsonValue &json, std::vector<T> *value)
+bool deserialize(const QJsonValue &json, std::deque<T> *value)
+{
+    return Internal::deserializeSequence(json, value, "deque");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+bool deserialize(const QJsonValue &json, std::array<T, N> *value)
 {
     Q_ASSERT(value != nullptr);
 
     // Get the JSON Array representation
     if (!json.isArray())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not an Array");
         return false;
     }
 
     const auto jsonArray = json.toArray();
 
-    // Deserialize elements
-    value->clear();
-    value->reserve(static_cast<size_t>(jsonArray.size()));
-    int index = 0;
-
-    for (const auto &item : jsonArray)
+    if (static_cast<std::size_t>(jsonArray.size()) != N)
     {
-        T deserializedItem;
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
+                << QString("JSON Array needs to have exactly %1 items but it has %2!")
+                   .arg(N)
+                   .arg(jsonArray.size());
+        return false;
+    }
 
-        if (!deserialize(item, &deserializedItem))
+    // Deserialize elements in place
+    for (int index = 0; index < jsonArray.size(); index++)
+    {
+        if (!deserialize(jsonArray.at(index), &(*value)[static_cast<std::size_t>(index)]))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the vector element at index:")
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, index)
+                    << QStringLiteral("Failed to deserialize the array element at index:")
                     << index;
             return false;
         }
-
-        value->push_back(std::move(deserializedItem));
-        index++;
     }
 
     return true;
@@ -715,42 +1506,170 @@ bool deserialize(const QJsonValue &json, std::vector<T> *value)
 // -------------------------------------------------------------------------------------------------
 
 template<typename T>
-bool deserialize(const QJsonValue &json, QSet<T> *value)
+bool deserialize(const QJsonValue &json, std::set<T> *value)
 {
-    Q_ASSERT(value != nullptr);
+    return Internal::deserializeSet(json, value);
+}
 
-    // Get the JSON Array representation
-    if (!json.isArray())
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("JSON value is not an Array");
-        return false;
-    }
+// -------------------------------------------------------------------------------------------------
 
-    const auto jsonArray = json.toArray();
+template<typename T>
+bool deserialize(const QJsonValue &json, std::unordered_set<T> *value)
+{
+    return Internal::deserializeSet(json, value);
+}
 
-    // Deserialize elements
-    value->clear();
+// -------------------------------------------------------------------------------------------------
 
-    for (const auto &item : jsonArray)
+namespace Internal
+{
+
+/*!
+ * Inserts the item to the map
+ *
+ * \tparam  K   Key type
+ * \tparam  V   Value type
+ *
+ * \param[out]  container   Container
+ * \param       key         Key (it can be moved from)
+ * \param       item        Value (it can be moved from)
+ *
+ * \note    The members of a JSON Object are iterated in the order of their keys, so for an ordered
+ *          map the item is inserted with the end of the map as the hint. This makes the insertion
+ *          of the already sorted keys a constant time operation. For keys that are not sorted (for
+ *          example numbers) the hint is ignored and a regular insertion is done.
+ */
+template<typename K, typename V>
+void insertMapItem(QMap<K, V> *container, K &key, V &item)
+{
+    container->insert(container->constEnd(), key, item);
+}
+
+//! \copydoc    CedarFramework::Internal::insertMapItem()
+template<typename K, typename V, typename Compare, typename Allocator>
+void insertMapItem(std::map<K, V, Compare, Allocator> *container, K &key, V &item)
+{
+    container->emplace_hint(container->end(), std::move(key), std::move(item));
+}
+
+//! \copydoc    CedarFramework::Internal::insertMapItem()
+template<typename K, typename V>
+void insertMapItem(QHash<K, V> *container, K &key, V &item)
+{
+    container->insert(key, item);
+}
+
+//! \copydoc    CedarFramework::Internal::insertMapItem()
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+void insertMapItem(std::unordered_map<K, V, Hash, KeyEqual, Allocator> *container,
+                   K &key,
+                   V &item)
+{
+    container->emplace(std::move(key), std::move(item));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Finds the item with the specified key in the map container
+ *
+ * \tparam  K   Key type
+ * \tparam  V   Value type
+ *
+ * \param   container   Container
+ * \param   key         Key
+ *
+ * \return  Item or a null pointer if the container has no item with the specified key
+ */
+template<typename K, typename V>
+V *findMapItem(QMap<K, V> *container, const K &key)
+{
+    auto it = container->find(key);
+    return (it != container->end()) ? &it.value() : nullptr;
+}
+
+//! \copydoc    CedarFramework::Internal::findMapItem()
+template<typename K, typename V, typename Compare, typename Allocator>
+V *findMapItem(std::map<K, V, Compare, Allocator> *container, const K &key)
+{
+    auto it = container->find(key);
+    return (it != container->end()) ? &it->second : nullptr;
+}
+
+//! \copydoc    CedarFramework::Internal::findMapItem()
+template<typename K, typename V>
+V *findMapItem(QHash<K, V> *container, const K &key)
+{
+    auto it = container->find(key);
+    return (it != container->end()) ? &it.value() : nullptr;
+}
+
+//! \copydoc    CedarFramework::Internal::findMapItem()
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+V *findMapItem(std::unordered_map<K, V, Hash, KeyEqual, Allocator> *container, const K &key)
+{
+    auto it = container->find(key);
+    return (it != container->end()) ? &it->second : nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes the items of a map container
+ *
+ * \tparam  C   Container type
+ *
+ * \param       jsonObject      JSON Object
+ * \param[out]  value           Output for the deserialized value
+ * \param       containerName   Name of the container used in the error messages
+ * \param[out]  updatedItems    Optional output for the existing items that were updated in place,
+ *                              if not set then all of the items are inserted into the container
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename C>
+bool deserializeMapItems(const QJsonObject &jsonObject,
+                         C *value,
+                         const char *containerName,
+                         QVarLengthArray<const void *, 64> *updatedItems)
+{
+    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
     {
-        T deserializedItem;
+        // Deserialize key
+        auto deserializedKey = createItem<typename C::key_type>(*value);
 
-        if (!deserialize(item, &deserializedItem))
+        if (!deserializeKey(it.key(), &deserializedKey))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the set element");
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, it.key())
+                    << QString("Failed to deserialize the key in a %1")
+                       .arg(QLatin1String(containerName));
             return false;
         }
 
-        if (value->contains(deserializedItem))
+        // Deserialize value
+        auto *existingValue =
+                (updatedItems != nullptr) ? findMapItem(value, deserializedKey) : nullptr;
+        auto deserializedValue = createItem<typename C::mapped_type>(*value);
+
+        if (!deserialize(it.value(),
+                         (existingValue != nullptr) ? existingValue : &deserializedValue))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Duplicate set element");
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, it.key())
+                    << QString("Failed to deserialize the %1 item's value with key:")
+                       .arg(QLatin1String(containerName))
+                    << it.key();
             return false;
         }
 
-        value->insert(deserializedItem);
+        if (existingValue == nullptr)
+        {
+            insertMapItem(value, deserializedKey, deserializedValue);
+        }
+        else
+        {
+            updatedItems->append(existingValue);
+        }
     }
 
     return true;
@@ -758,64 +1677,187 @@ bool deserialize(const QJsonValue &json, QSet<T> *value)
 
 // -------------------------------------------------------------------------------------------------
 
-template<typename K, typename V>
-bool deserialize(const QJsonValue &json, QMap<K, V> *value)
+/*!
+ * Deserializes a map container
+ *
+ * \tparam  C   Container type
+ *
+ * \param       json            JSON value (*JSON Object*)
+ * \param[out]  value           Output for the deserialized value
+ * \param       containerName   Name of the container used in the error messages
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    If the storage is reused and the container holds as many items as there are members in
+ *          the JSON Object, the items are first updated in place. The container is rebuilt if it
+ *          turns out that not every existing item was updated by a different member, for example
+ *          when a key was missing or when the members "1" and "01" both matched the same item.
+ */
+template<typename C>
+bool deserializeMap(const QJsonValue &json, C *value, const char *containerName)
 {
     Q_ASSERT(value != nullptr);
 
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not an Object");
         return false;
     }
 
     const auto jsonObject = json.toObject();
 
-    // Deserialize members
-    value->clear();
-
-    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    // Update the existing items
+    if (isStorageReuseEnabled() && (static_cast<int>(value->size()) == jsonObject.size()))
     {
-        // Deserialize key
-        K deserializedKey;
+        QVarLengthArray<const void *, 64> updatedItems;
 
-        if (!deserializeKey(it.key(), &deserializedKey))
+        if (!deserializeMapItems(jsonObject, value, containerName, &updatedItems))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the key in a map");
             return false;
         }
 
-        // Deserialize value
-        V deserializedValue;
+        // Different members can match the same item, so the updated items need to be counted only
+        // once. All keys matched only if every item in the container was updated.
+        std::sort(updatedItems.begin(), updatedItems.end(), std::less<const void *>());
+        const auto updatedEnd = std::unique(updatedItems.begin(), updatedItems.end());
 
-        if (!deserialize(it.value(), &deserializedValue))
+        if (static_cast<int>(updatedEnd - updatedItems.begin()) == static_cast<int>(value->size()))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the map item's value with key:")
-                    << it.key();
-            return false;
+            return true;
         }
+    }
+
+    // Deserialize members
+    value->clear();
+    reserveItems(value, jsonObject.size());
+
+    return deserializeMapItems(jsonObject, value, containerName, nullptr);
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename K, typename V>
+bool deserialize(const QJsonValue &json, QMap<K, V> *value)
+{
+    return Internal::deserializeMap(json, value, "map");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename K, typename V>
+bool deserialize(const QJsonValue &json, std::map<K, V> *value)
+{
+    return Internal::deserializeMap(json, value, "map");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename K, typename V>
+bool deserialize(const QJsonValue &json, QHash<K, V> *value)
+{
+    return Internal::deserializeMap(json, value, "hash");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename K, typename V>
+bool deserialize(const QJsonValue &json, std::unordered_map<K, V> *value)
+{
+    return Internal::deserializeMap(json, value, "unordered map");
+}
+
+#ifdef CEDARFRAMEWORK_HAS_STD_PMR
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserialize(const QJsonValue &json, std::pmr::vector<T> *value)
+{
+    return Internal::deserializeSequence(json, value, "vector");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename K, typename V>
+bool deserialize(const QJsonValue &json, std::pmr::map<K, V> *value)
+{
+    return Internal::deserializeMap(json, value, "map");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename K, typename V>
+bool deserialize(const QJsonValue &json, std::pmr::unordered_map<K, V> *value)
+{
+    return Internal::deserializeMap(json, value, "unordered map");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool deserialize(const QJsonValue &json, std::pmr::string *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    if (!json.isString())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not a string:") << json;
+        return false;
+    }
+
+    // The string is read directly so that it isn't interned, only the converted value is kept
+    const QString stringValue = json.toString();
+
+    value->resize(Internal::encodeUtf8(stringValue, nullptr));
+    Internal::encodeUtf8(stringValue, &(*value)[0]);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
 
-        value->insert(deserializedKey, deserializedValue);
-    }
+inline bool deserializeKey(const QString &value, std::pmr::string *key)
+{
+    Q_ASSERT(key != nullptr);
 
+    key->resize(Internal::encodeUtf8(value, nullptr));
+    Internal::encodeUtf8(value, &(*key)[0]);
     return true;
 }
+#endif
 
 // -------------------------------------------------------------------------------------------------
 
-template<typename K, typename V>
-bool deserialize(const QJsonValue &json, std::map<K, V> *value)
+namespace Internal
+{
+
+/*!
+ * Deserializes a multi map container
+ *
+ * \tparam  C   Container type
+ *
+ * \param       json            JSON value (*JSON Object* with a *JSON Array* for each key)
+ * \param[out]  value           Output for the deserialized value
+ * \param       containerName   Name of the container used in the error messages
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    The items of the JSON Array are inserted into the container directly as they are
+ *          deserialized, without collecting them in a temporary container first
+ */
+template<typename C>
+bool deserializeMultiMap(const QJsonValue &json, C *value, const char *containerName)
 {
     Q_ASSERT(value != nullptr);
 
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not an Object");
         return false;
     }
@@ -824,237 +1866,285 @@ bool deserialize(const QJsonValue &json, std::map<K, V> *value)
 
     // Deserialize members
     value->clear();
+    reserveItems(value, jsonObject.size());
 
     for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
     {
         // Deserialize key
-        K deserializedKey;
+        typename C::key_type deserializedKey;
 
         if (!deserializeKey(it.key(), &deserializedKey))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the key in a map");
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, it.key())
+                    << QString("Failed to deserialize the key in a %1")
+                       .arg(QLatin1String(containerName));
             return false;
         }
 
-        // Deserialize value
-        V deserializedValue;
-
-        if (!deserialize(it.value(), &deserializedValue))
+        // Deserialize values
+        if (!it.value().isArray())
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the map item's value with key:")
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                    << QStringLiteral("JSON value is not an Array");
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, it.key())
+                    << QString("Failed to deserialize the %1 item's value with key:")
+                       .arg(QLatin1String(containerName))
                     << it.key();
             return false;
         }
 
-        value->emplace(deserializedKey, deserializedValue);
+        const auto jsonArray = it.value().toArray();
+        int index = 0;
+
+        for (const auto &item : jsonArray)
+        {
+            typename C::mapped_type deserializedValue;
+
+            if (!deserialize(item, &deserializedValue))
+            {
+                CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, index)
+                        << QString("Failed to deserialize the %1 element at index:")
+                           .arg(QLatin1String(containerName))
+                        << index;
+                CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, it.key())
+                        << QString("Failed to deserialize the %1 item's value with key:")
+                           .arg(QLatin1String(containerName))
+                        << it.key();
+                return false;
+            }
+
+            value->insert(deserializedKey, deserializedValue);
+            index++;
+        }
     }
 
     return true;
 }
 
+} // namespace Internal
+
 // -------------------------------------------------------------------------------------------------
 
 template<typename K, typename V>
-bool deserialize(const QJsonValue &json, QHash<K, V> *value)
+bool deserialize(const QJsonValue &json, QMultiMap<K, V> *value)
 {
-    Q_ASSERT(value != nullptr);
+    return Internal::deserializeMultiMap(json, value, "multi map");
+}
 
-    // Get the JSON Object representation
-    if (!json.isObject())
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("JSON value is not an Object");
-        return false;
-    }
+// -------------------------------------------------------------------------------------------------
 
-    const auto jsonObject = json.toObject();
+template<typename K, typename V>
+bool deserialize(const QJsonValue &json, QMultiHash<K, V> *value)
+{
+    return Internal::deserializeMultiMap(json, value, "multi hash");
+}
 
-    // Deserialize members
-    value->clear();
+// -------------------------------------------------------------------------------------------------
 
-    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
-    {
-        // Deserialize key
-        K deserializedKey;
+namespace Internal
+{
 
-        if (!deserializeKey(it.key(), &deserializedKey))
-        {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the key in a hash");
-            return false;
-        }
+/*!
+ * Deserializes the polymorphic value by creating the derived type selected by the type tag
+ *
+ * \tparam  T   Base type
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T>
+bool deserializePolymorphic(const QJsonValue &json, std::unique_ptr<T> *value)
+{
+    QString tag;
+    QJsonValue taggedValue;
 
-        // Deserialize value
-        V deserializedValue;
+    if (!parseTaggedValue(json, &tag, &taggedValue))
+    {
+        return false;
+    }
 
-        if (!deserialize(it.value(), &deserializedValue))
-        {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the hash item's value with key:")
-                    << it.key();
-            return false;
-        }
+    typename PolymorphicTypeRegistry<T>::Entry entry;
+
+    if (!PolymorphicTypeRegistry<T>::instance().find(tag, &entry))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
+                << QStringLiteral("No derived type is registered for the type tag:") << tag;
+        return false;
+    }
 
-        value->insert(deserializedKey, deserializedValue);
+    if (!entry.factory(taggedValue, value))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("value"))
+                << QStringLiteral("Failed to deserialize the value of the type:") << tag;
+        return false;
     }
 
     return true;
 }
 
+#ifdef CEDARFRAMEWORK_HAS_STD_VARIANT
 // -------------------------------------------------------------------------------------------------
 
-template<typename K, typename V>
-bool deserialize(const QJsonValue &json, std::unordered_map<K, V> *value)
+/*!
+ * Deserializes an alternative of the std::variant value
+ *
+ * \tparam  I   Index of the alternative
+ * \tparam  V   std::variant type
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<std::size_t I, typename V>
+bool deserializeVariantAlternative(const QJsonValue &json, V *value)
 {
-    Q_ASSERT(value != nullptr);
-
-    // Get the JSON Object representation
-    if (!json.isObject())
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("JSON value is not an Object");
-        return false;
-    }
-
-    const auto jsonObject = json.toObject();
+    return deserialize(json, &value->template emplace<I>());
+}
 
-    // Deserialize members
-    value->clear();
+// -------------------------------------------------------------------------------------------------
 
-    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+/*!
+ * Deserializes the std::variant value directly to the alternative selected by the type tag
+ *
+ * \tparam  V   std::variant type
+ * \tparam  I   Indexes of the alternatives
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename V, std::size_t... I>
+bool deserializeVariant(const QJsonValue &json, V *value, std::index_sequence<I...>)
+{
+    using AlternativeDeserializer = bool (*)(const QJsonValue &, V *);
+    static const AlternativeDeserializer deserializers[] = {
+        &deserializeVariantAlternative<I, V>...
+    };
+    // The alternatives with an ambiguous type tag are mapped to -1 so that they are rejected
+    static const QHash<QString, int> alternatives = []()
     {
-        // Deserialize key
-        K deserializedKey;
+        QHash<QString, int> indexes;
+        int index = 0;
 
-        if (!deserializeKey(it.key(), &deserializedKey))
+        for (const QString &tag : { TypeTag<std::variant_alternative_t<I, V>>::name()... })
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the key in an unordered map");
-            return false;
+            if (indexes.contains(tag))
+            {
+                qCWarning(CedarFramework::LoggingCategory::Deserialization)
+                        << QStringLiteral("Type tag is used by multiple std::variant alternatives:")
+                        << tag;
+                Q_ASSERT_X(false, "deserializeVariant", "Type tag is not unique");
+                indexes.insert(tag, -1);
+            }
+            else
+            {
+                indexes.insert(tag, index);
+            }
+
+            index++;
         }
 
-        // Deserialize value
-        V deserializedValue;
+        return indexes;
+    }();
 
-        if (!deserialize(it.value(), &deserializedValue))
-        {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the unordered map item's value with "
-                                      "key:") << it.key();
-            return false;
-        }
+    QString tag;
+    QJsonValue taggedValue;
 
-        value->emplace(deserializedKey, deserializedValue);
+    if (!parseTaggedValue(json, &tag, &taggedValue))
+    {
+        return false;
     }
 
-    return true;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename K, typename V>
-bool deserialize(const QJsonValue &json, QMultiMap<K, V> *value)
-{
-    Q_ASSERT(value != nullptr);
+    const auto it = alternatives.constFind(tag);
 
-    // Get the JSON Object representation
-    if (!json.isObject())
+    if (it == alternatives.constEnd())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("JSON value is not an Object");
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
+                << QStringLiteral("No std::variant alternative has the type tag:") << tag;
         return false;
     }
 
-    const auto jsonObject = json.toObject();
-
-    // Deserialize members
-    value->clear();
+    if (it.value() < 0)
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
+                << QStringLiteral("Multiple std::variant alternatives have the type tag:") << tag;
+        return false;
+    }
 
-    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    if (!deserializers[it.value()](taggedValue, value))
     {
-        // Deserialize key
-        K deserializedKey;
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("value"))
+                << QStringLiteral("Failed to deserialize the std::variant alternative of the type:")
+                << tag;
+        return false;
+    }
 
-        if (!deserializeKey(it.key(), &deserializedKey))
-        {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the key in a multi map");
-            return false;
-        }
+    return true;
+}
+#endif
 
-        // Deserialize values
-        QVector<V> deserializedValues;
+} // namespace Internal
 
-        if (!deserialize(it.value(), &deserializedValues))
-        {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the multi map item's value with key:")
-                    << it.key();
-            return false;
-        }
+// -------------------------------------------------------------------------------------------------
 
-        for (const auto &item : deserializedValues)
-        {
-            value->insert(deserializedKey, item);
-        }
+template<typename T>
+bool deserialize(const QJsonValue &json, std::unique_ptr<T> *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    if (json.isNull())
+    {
+        value->reset();
+        return true;
     }
 
-    return true;
+    return Internal::deserializePolymorphic(json, value);
 }
 
 // -------------------------------------------------------------------------------------------------
 
-template<typename K, typename V>
-bool deserialize(const QJsonValue &json, QMultiHash<K, V> *value)
+template<typename T>
+bool deserialize(const QJsonValue &json, std::shared_ptr<T> *value)
 {
     Q_ASSERT(value != nullptr);
 
-    // Get the JSON Object representation
-    if (!json.isObject())
+    if (json.isNull())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("JSON value is not an Object");
-        return false;
+        value->reset();
+        return true;
     }
 
-    const auto jsonObject = json.toObject();
-
-    // Deserialize members
-    value->clear();
+    std::unique_ptr<T> deserializedValue;
 
-    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    if (!Internal::deserializePolymorphic(json, &deserializedValue))
     {
-        // Deserialize key
-        K deserializedKey;
-
-        if (!deserializeKey(it.key(), &deserializedKey))
-        {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the key in a multi map");
-            return false;
-        }
+        return false;
+    }
 
-        // Deserialize values
-        QVector<V> deserializedValues;
+    *value = std::move(deserializedValue);
+    return true;
+}
 
-        if (!deserialize(it.value(), &deserializedValues))
-        {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                    << QStringLiteral("Failed to deserialize the multi hash item's value with key:")
-                    << it.key();
-            return false;
-        }
+#ifdef CEDARFRAMEWORK_HAS_STD_VARIANT
+// -------------------------------------------------------------------------------------------------
 
-        for (const auto &item : deserializedValues)
-        {
-            value->insert(deserializedKey, item);
-        }
-    }
+template<typename... T>
+bool deserialize(const QJsonValue &json, std::variant<T...> *value)
+{
+    Q_ASSERT(value != nullptr);
 
-    return true;
+    return Internal::deserializeVariant(json, value, std::index_sequence_for<T...>());
 }
+#endif
 
 // -------------------------------------------------------------------------------------------------
 
@@ -1075,12 +2165,19 @@ bool deserializeNode(const QJsonValue &data, const int index, T *value)
 
     if (node.isUndefined())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("Failed to find the specified node");
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::NodeNotFound, index)
+                << QStringLiteral("Failed to find the node:") << index;
         return false;
     }
 
-    return deserialize(node, value);
+    if (!deserialize(node, value))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, index)
+                << QStringLiteral("Failed to deserialize the node:") << index;
+        return false;
+    }
+
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1092,12 +2189,19 @@ bool deserializeNode(const QJsonValue &data, const QString &name, T *value)
 
     if (node.isUndefined())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("Failed to find the specified node");
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::NodeNotFound, name)
+                << QStringLiteral("Failed to find the node:") << name;
+        return false;
+    }
+
+    if (!deserialize(node, value))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, name)
+                << QStringLiteral("Failed to deserialize the node:") << name;
         return false;
     }
 
-    return deserialize(node, value);
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1109,12 +2213,17 @@ bool deserializeNode(const QJsonValue &data, const QVariantList &nodePath, T *va
 
     if (node.isUndefined())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("Failed to find the specified node");
+        Internal::reportNodePathError(DeserializationErrorCode::NodeNotFound, nodePath);
+        return false;
+    }
+
+    if (!deserialize(node, value))
+    {
+        Internal::reportNodePathError(DeserializationErrorCode::ItemFailed, nodePath);
         return false;
     }
 
-    return deserialize(node, value);
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1126,12 +2235,17 @@ bool deserializeNode(const QJsonValue &data, const QStringList &nodePath, T *val
 
     if (node.isUndefined())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QStringLiteral("Failed to find the specified node");
+        Internal::reportNodePathError(DeserializationErrorCode::NodeNotFound, nodePath);
+        return false;
+    }
+
+    if (!deserialize(node, value))
+    {
+        Internal::reportNodePathError(DeserializationErrorCode::ItemFailed, nodePath);
         return false;
     }
 
-    return deserialize(node, value);
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1152,11 +2266,14 @@ bool deserializeOptionalNode(const QJsonValue &data,
     if (node.isUndefined())
     {
         // Node not found, not a failure as this is an optional node
+        Internal::resetOptionalValue(value);
         return true;
     }
 
     if (!deserialize(node, value))
     {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, index)
+                << QStringLiteral("Failed to deserialize the node:") << index;
         return false;
     }
 
@@ -1185,11 +2302,14 @@ bool deserializeOptionalNode(const QJsonValue &data,
     if (node.isUndefined())
     {
         // Node not found, not a failure as this is an optional node
+        Internal::resetOptionalValue(value);
         return true;
     }
 
     if (!deserialize(node, value))
     {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, name)
+                << QStringLiteral("Failed to deserialize the node:") << name;
         return false;
     }
 
@@ -1218,11 +2338,13 @@ bool deserializeOptionalNode(const QJsonValue &data,
     if (node.isUndefined())
     {
         // Node not found, not a failure as this is an optional node
+        Internal::resetOptionalValue(value);
         return true;
     }
 
     if (!deserialize(node, value))
     {
+        Internal::reportNodePathError(DeserializationErrorCode::ItemFailed, nodePath);
         return false;
     }
 
@@ -1251,11 +2373,13 @@ bool deserializeOptionalNode(const QJsonValue &data,
     if (node.isUndefined())
     {
         // Node not found, not a failure as this is an optional node
+        Internal::resetOptionalValue(value);
         return true;
     }
 
     if (!deserialize(node, value))
     {
+        Internal::reportNodePathError(DeserializationErrorCode::ItemFailed, nodePath);
         return false;
     }
 
@@ -1266,4 +2390,77 @@ bool deserializeOptionalNode(const QJsonValue &data,
     return true;
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserialize(const QJsonValue &json, T *value, const EncodingProfile &profile)
+{
+    const EncodingScope scope(profile);
+    return deserialize(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserializeInto(const QJsonValue &json, T *value)
+{
+    const Internal::StorageReuseScope scope;
+    return deserialize(json, value);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Explicit instantiations
+// -------------------------------------------------------------------------------------------------
+
+// Deserialization of the common containers is instantiated in the library so that it isn't
+// instantiated again in each translation unit that uses it
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QList<int> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QList<double> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QList<QString> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QList<QVariant> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QVector<int> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QVector<double> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QVector<QString> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, std::vector<int> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, std::vector<double> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, std::vector<QString> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QMap<QString, int> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QMap<QString, double> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QMap<QString, QString> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QMap<QString, QVariant> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QHash<QString, QString> *);
+
+extern template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QHash<QString, QVariant> *);
+
 } // namespace CedarFramework
@@ -0,0 +1,319 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the reporting of deserialization errors
+ */
+
+#pragma once
+
+// Cedar Framework includes
+#include <CedarFramework/CedarFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QStringList>
+#include <QtCore/QVariant>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+/*!
+ * Reports a deserialization error to the active error sink
+ *
+ * Parameters are passed to the CedarFramework::Internal::DeserializationErrorReport constructor.
+ * Same as with qCWarning() a message can be streamed into it and it is only formatted if the active
+ * error sink needs the message.
+ */
+#define CEDARFRAMEWORK_DESERIALIZATION_ERROR(...) \
+    for (CedarFramework::Internal::DeserializationErrorReport errorReport(__VA_ARGS__); \
+         errorReport.isPending(); \
+         errorReport.finish()) \
+        errorReport.stream()
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+//! Deserialization error codes
+enum class DeserializationErrorCode
+{
+    //! JSON value has a type that can't be deserialized to the native type
+    InvalidType,
+
+    //! JSON value has a supported type but doesn't represent a valid native value
+    InvalidValue,
+
+    //! Numeric value is out of range for the native type
+    OutOfRange,
+
+    //! JSON Array or JSON Object has an unexpected number of items or members
+    InvalidSize,
+
+    //! JSON Array contains a duplicated set item
+    DuplicateItem,
+
+    //! Deserialization of an item in a JSON Array or a member in a JSON Object failed
+    ItemFailed,
+
+    //! Node to deserialize was not found
+    NodeNotFound
+};
+
+//! Interface for receiving deserialization errors
+class CEDARFRAMEWORK_EXPORT DeserializationErrorSink
+{
+public:
+    //! Destructor
+    virtual ~DeserializationErrorSink();
+
+    /*!
+     * Checks if the sink needs the error messages
+     *
+     * \retval  true    Error messages are needed
+     * \retval  false   Error messages are not needed and are not formatted at all
+     *
+     * \note    Error messages are not needed by default
+     */
+    virtual bool isMessageEnabled() const;
+
+    /*!
+     * Receives a deserialization error
+     *
+     * \param   code        Error code
+     * \param   pathElement For DeserializationErrorCode::ItemFailed the index (int) of the item or
+     *                      the name (QString) of the member, otherwise an invalid QVariant
+     * \param   message     Error message or a null string if messages are not needed
+     *
+     * \note    A failed deserialization first reports the error of the innermost value and then the
+     *          DeserializationErrorCode::ItemFailed errors of the enclosing containers, if any
+     */
+    virtual void reportError(DeserializationErrorCode code,
+                             const QVariant &pathElement,
+                             const QString &message) = 0;
+};
+
+//! Error sink that logs the error messages with the deserialization logging category (default)
+class CEDARFRAMEWORK_EXPORT DeserializationErrorLogger : public DeserializationErrorSink
+{
+public:
+    //! \copydoc    CedarFramework::DeserializationErrorSink::isMessageEnabled()
+    bool isMessageEnabled() const override;
+
+    //! \copydoc    CedarFramework::DeserializationErrorSink::reportError()
+    void reportError(DeserializationErrorCode code,
+                     const QVariant &pathElement,
+                     const QString &message) override;
+};
+
+/*!
+ * Error sink that records the first error code and its path without formatting any messages
+ *
+ * The path of the first error is extended by the DeserializationErrorCode::ItemFailed errors of the
+ * enclosing containers. It is complete once any other error is reported (for example by another
+ * deserialization or by an alternative that is tried next), the following errors are then ignored
+ * until the collector is cleared.
+ */
+class CEDARFRAMEWORK_EXPORT DeserializationErrorCollector : public DeserializationErrorSink
+{
+public:
+    /*!
+     * Checks if an error was recorded
+     *
+     * \retval  true    Error was recorded
+     * \retval  false   No error was recorded
+     */
+    bool hasError() const;
+
+    /*!
+     * Gets the code of the recorded error
+     *
+     * \return  Error code of the innermost value that failed to be deserialized
+     */
+    DeserializationErrorCode errorCode() const;
+
+    /*!
+     * Gets the path to the value that failed to be deserialized
+     *
+     * \return  List of indexes (int) and/or member names (QString) starting at the root node
+     *
+     * \note    The path can be passed to CedarFramework::getNode() to get the failed value
+     */
+    QVariantList path() const;
+
+    /*!
+     * Formats the recorded error
+     *
+     * \return  Error description (for example "OutOfRange at [2].size.width") or an empty string if
+     *          no error was recorded
+     */
+    QString toString() const;
+
+    //! Clears the recorded error so that the next one can be recorded
+    void clear();
+
+    //! \copydoc    CedarFramework::DeserializationErrorSink::reportError()
+    void reportError(DeserializationErrorCode code,
+                     const QVariant &pathElement,
+                     const QString &message) override;
+
+private:
+    //! Flag that indicates that an error was recorded
+    bool m_hasError = false;
+
+    //! Flag that indicates that the path of the recorded error is complete
+    bool m_pathComplete = false;
+
+    //! Code of the recorded error
+    DeserializationErrorCode m_errorCode = DeserializationErrorCode::InvalidValue;
+
+    //! Path to the failed value
+    QVariantList m_path;
+};
+
+/*!
+ * Gets the error sink that is active in the current thread
+ *
+ * \return  Active error sink
+ *
+ * \note    By default the errors are logged with DeserializationErrorLogger
+ */
+CEDARFRAMEWORK_EXPORT DeserializationErrorSink &activeDeserializationErrorSink();
+
+//! Activates an error sink in the current thread for the lifetime of the object
+class CEDARFRAMEWORK_EXPORT DeserializationErrorScope
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   sink    Error sink to activate
+     *
+     * \note    The sink needs to outlive this object!
+     */
+    explicit DeserializationErrorScope(DeserializationErrorSink *sink);
+
+    //! Destructor, restores the previously active error sink
+    ~DeserializationErrorScope();
+
+    //! Copy constructor is disabled
+    DeserializationErrorScope(const DeserializationErrorScope &) = delete;
+
+    //! Copy assignment operator is disabled
+    DeserializationErrorScope &operator=(const DeserializationErrorScope &) = delete;
+
+private:
+    //! Previously active error sink
+    DeserializationErrorSink *m_previousSink;
+};
+
+namespace Internal
+{
+
+//! Single error report, used through the CEDARFRAMEWORK_DESERIALIZATION_ERROR() macro
+class CEDARFRAMEWORK_EXPORT DeserializationErrorReport
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   code    Error code
+     */
+    explicit DeserializationErrorReport(DeserializationErrorCode code);
+
+    /*!
+     * Constructor for a failed item in a JSON Array
+     *
+     * \param   code    Error code
+     * \param   index   Index of the item
+     */
+    DeserializationErrorReport(DeserializationErrorCode code, int index);
+
+    /*!
+     * Constructor for a failed member in a JSON Object
+     *
+     * \param   code    Error code
+     * \param   name    Name of the member
+     */
+    DeserializationErrorReport(DeserializationErrorCode code, const QString &name);
+
+    /*!
+     * Checks if the error still needs to be reported
+     *
+     * \retval  true    Message needs to be streamed and the error reported with finish()
+     * \retval  false   Error was already reported
+     */
+    bool isPending() const
+    {
+        return m_pending;
+    }
+
+    /*!
+     * Creates a stream for the error message
+     *
+     * \return  Stream for the error message
+     */
+    QDebug stream()
+    {
+        return QDebug(&m_message);
+    }
+
+    //! Reports the error to the active error sink
+    void finish();
+
+private:
+    //! Initializes the report and reports the error immediately if no message is needed
+    void initialize();
+
+    //! Error sink
+    DeserializationErrorSink &m_sink;
+
+    //! Error code
+    const DeserializationErrorCode m_code;
+
+    //! Path element
+    const QVariant m_pathElement;
+
+    //! Error message
+    QString m_message;
+
+    //! Flag that indicates that the error still needs to be reported
+    bool m_pending;
+};
+
+/*!
+ * Reports the error of the node at the specified path
+ *
+ * \param   code        Error code for the last element of the path
+ * \param   nodePath    Path to the node (list of indexes and/or member names)
+ *
+ * \note    The enclosing elements of the path are reported as DeserializationErrorCode::ItemFailed
+ *          so that the whole path is reported
+ */
+CEDARFRAMEWORK_EXPORT void reportNodePathError(DeserializationErrorCode code,
+                                               const QVariantList &nodePath);
+
+//! \copydoc    CedarFramework::Internal::reportNodePathError()
+CEDARFRAMEWORK_EXPORT void reportNodePathError(DeserializationErrorCode code,
+                                               const QStringList &nodePath);
+
+} // namespace Internal
+
+} // namespace CedarFramework
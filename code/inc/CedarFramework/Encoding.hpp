@@ -0,0 +1,187 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the encoding profile used for serialization and deserialization of the types that have
+ * an alternative compact encoding
+ */
+
+#pragma once
+
+// Cedar Framework includes
+#include <CedarFramework/CedarFrameworkExport.hpp>
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+//! Encoding of a value in JSON
+enum class Encoding
+{
+    //! Human-readable encoding (for example an ISO 8601 string)
+    Text,
+
+    //! Compact encoding (for example a number instead of a string)
+    Compact
+};
+
+//! Selects the encoding of the types that have an alternative compact encoding
+struct CEDARFRAMEWORK_EXPORT EncodingProfile
+{
+    /*!
+     * Creates a profile with the text encoding for all types
+     *
+     * \return  Text encoding profile
+     */
+    static EncodingProfile text();
+
+    /*!
+     * Creates a profile with the compact encoding for all types
+     *
+     * \return  Compact encoding profile
+     */
+    static EncodingProfile compact();
+
+    /*!
+     * Encoding of QDate values:
+     *
+     * - Text: *JSON String* in ISO 8601 format
+     * - Compact: *JSON Number* with the Julian day
+     */
+    Encoding date = Encoding::Text;
+
+    /*!
+     * Encoding of QTime values:
+     *
+     * - Text: *JSON String* in ISO 8601 format
+     * - Compact: *JSON Number* with the milliseconds since midnight
+     */
+    Encoding time = Encoding::Text;
+
+    /*!
+     * Encoding of QDateTime values:
+     *
+     * - Text: *JSON String* in ISO 8601 format
+     * - Compact: *JSON Number* with the milliseconds since epoch for local time, otherwise a
+     *   *JSON Array* with the milliseconds since epoch and the offset from UTC in seconds
+     */
+    Encoding dateTime = Encoding::Text;
+
+    /*!
+     * Encoding of QUuid values:
+     *
+     * - Text: *JSON String* in "{xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}" format
+     * - Compact: *JSON String* with the 16 bytes (RFC 4122) in base64 encoding without padding
+     */
+    Encoding uuid = Encoding::Text;
+
+    /*!
+     * Encoding of QSize, QSizeF, QPoint, QPointF, QLine, QLineF, QRect and QRectF values:
+     *
+     * - Text: *JSON Object* with named members
+     * - Compact: *JSON Array* with the members in the same order as in the text encoding (for
+     *   example [x, y, width, height] for a rectangle)
+     */
+    Encoding geometry = Encoding::Text;
+
+    /*!
+     * Encoding of QPair and std::pair values:
+     *
+     * - Text: *JSON Object* with "first" and "second" members
+     * - Compact: *JSON Array* with [first, second] items
+     */
+    Encoding pair = Encoding::Text;
+};
+
+/*!
+ * Gets the encoding profile that is active in the current thread
+ *
+ * \return  Active encoding profile
+ *
+ * \note    By default the text encoding is used for all types
+ */
+CEDARFRAMEWORK_EXPORT const EncodingProfile &activeEncodingProfile();
+
+//! Activates an encoding profile in the current thread for the lifetime of the object
+class CEDARFRAMEWORK_EXPORT EncodingScope
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   profile     Encoding profile to activate
+     */
+    explicit EncodingScope(const EncodingProfile &profile);
+
+    //! Destructor, restores the previously active encoding profile
+    ~EncodingScope();
+
+    //! Copy constructor is disabled
+    EncodingScope(const EncodingScope &) = delete;
+
+    //! Copy assignment operator is disabled
+    EncodingScope &operator=(const EncodingScope &) = delete;
+
+private:
+    //! Previously active encoding profile
+    EncodingProfile m_previousProfile;
+};
+
+namespace Internal
+{
+
+/*!
+ * Checks if the SIMD code paths can be used in the current thread
+ *
+ * \retval  true    SIMD code paths are used if the CPU supports them
+ * \retval  false   Only the scalar code paths are used
+ */
+CEDARFRAMEWORK_EXPORT bool isSimdEnabled();
+
+//! Disables the SIMD code paths in the current thread for the lifetime of the object, used to
+//! compare their results with the scalar code paths
+class CEDARFRAMEWORK_EXPORT ScalarCodeScope
+{
+public:
+    //! Constructor
+    ScalarCodeScope();
+
+    //! Destructor, restores the previous state
+    ~ScalarCodeScope();
+
+    //! Copy constructor is disabled
+    ScalarCodeScope(const ScalarCodeScope &) = delete;
+
+    //! Copy assignment operator is disabled
+    ScalarCodeScope &operator=(const ScalarCodeScope &) = delete;
+
+private:
+    //! Previous state
+    bool m_previousState;
+};
+
+} // namespace Internal
+
+} // namespace CedarFramework
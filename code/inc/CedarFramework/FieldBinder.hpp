@@ -0,0 +1,240 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the binding of JSON Object members to native values
+ */
+
+#pragma once
+
+// Cedar Framework includes
+#include <CedarFramework/Deserialization.hpp>
+
+// Qt includes
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+/*!
+ * Deserializes a bound value
+ *
+ * \tparam  T   Value type
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value (pointer to T)
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T>
+bool deserializeBoundValue(const QJsonValue &json, void *value);
+
+/*!
+ * Resets a bound value that is missing in the JSON Object if the storage is reused
+ *
+ * \tparam  T   Value type
+ *
+ * \param[out]  value   Value to reset (pointer to T)
+ */
+template<typename T>
+void resetBoundValue(void *value);
+
+} // namespace Internal
+
+/*!
+ * Binds the members of a JSON Object to native values and deserializes all of them in a single pass
+ *
+ * Instead of looking up each of the members with deserializeNode() or deserializeOptionalNode() the
+ * bindings are kept sorted by their keys and they are matched by merging them with the (sorted)
+ * members of the JSON Object. Missing and unknown members are detected in the same pass.
+ *
+ * Example:
+ *
+ * \code
+ * int id;
+ * QString name;
+ * QStringList tags;
+ *
+ * CedarFramework::FieldBinder binder;
+ * binder.bind(QStringLiteral("id"), &id)
+ *       .bind(QStringLiteral("name"), &name)
+ *       .bindOptional(QStringLiteral("tags"), &tags);
+ *
+ * if (!binder.deserialize(json))
+ * {
+ *     // Handle error
+ * }
+ * \endcode
+ *
+ * \note    The bound values need to outlive the binder
+ */
+class CEDARFRAMEWORK_EXPORT FieldBinder
+{
+public:
+    /*!
+     * Binds a required member
+     *
+     * \tparam  T   Value type
+     *
+     * \param       key     Member name
+     * \param[out]  value   Output for the deserialized value
+     *
+     * \return  Reference to this binder
+     *
+     * \note    Binding the same member again replaces the previous binding
+     */
+    template<typename T>
+    FieldBinder &bind(const QString &key, T *value);
+
+    /*!
+     * Binds an optional member
+     *
+     * \tparam  T   Value type
+     *
+     * \param       key             Member name
+     * \param[out]  value           Output for the deserialized value
+     * \param[out]  deserialized    Optional output for the flag if the value was actually
+     *                              deserialized
+     *
+     * \return  Reference to this binder
+     *
+     * \note    Binding the same member again replaces the previous binding
+     * \note    If the member is missing while the storage is reused (see deserializeInto()) the
+     *          value is reset to a value-initialized value
+     */
+    template<typename T>
+    FieldBinder &bindOptional(const QString &key, T *value, bool *deserialized = nullptr);
+
+    /*!
+     * Deserializes the bound members
+     *
+     * \param       data        JSON Object to deserialize
+     * \param[out]  unknownKeys Optional output for the names of the members that are not bound
+     *
+     * \retval  true    Success (all required members were found and all found members were
+     *                  deserialized)
+     * \retval  false   Failure
+     */
+    bool deserialize(const QJsonValue &data, QStringList *unknownKeys = nullptr) const;
+
+private:
+    //! Deserialization function of a bound value
+    using Deserializer = bool (*)(const QJsonValue &, void *);
+
+    //! Reset function of a bound value
+    using Resetter = void (*)(void *);
+
+    //! Binding of a member
+    struct Binding
+    {
+        //! Member name
+        QString key;
+
+        //! Output for the deserialized value
+        void *value;
+
+        //! Deserialization function for the value
+        Deserializer deserializer;
+
+        //! Reset function for the value if the member is missing (only for optional members)
+        Resetter resetter;
+
+        //! Flag that indicates that the member is required
+        bool required;
+
+        //! Optional output for the flag if the value was actually deserialized
+        bool *deserialized;
+    };
+
+    /*!
+     * Adds a binding and keeps the bindings sorted by their keys
+     *
+     * \param   binding     Binding to add
+     */
+    void addBinding(const Binding &binding);
+
+    //! Bindings sorted by their keys
+    QVector<Binding> m_bindings;
+};
+
+// -------------------------------------------------------------------------------------------------
+// Template definitions
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+template<typename T>
+bool deserializeBoundValue(const QJsonValue &json, void *value)
+{
+    return CedarFramework::deserialize(json, static_cast<T *>(value));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+void resetBoundValue(void *value)
+{
+    resetOptionalValue(static_cast<T *>(value));
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+FieldBinder &FieldBinder::bind(const QString &key, T *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    addBinding(Binding {
+                   key, value, &Internal::deserializeBoundValue<T>, nullptr, true, nullptr
+               });
+    return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+FieldBinder &FieldBinder::bindOptional(const QString &key, T *value, bool *deserialized)
+{
+    Q_ASSERT(value != nullptr);
+
+    addBinding(Binding {
+                   key,
+                   value,
+                   &Internal::deserializeBoundValue<T>,
+                   &Internal::resetBoundValue<T>,
+                   false,
+                   deserialized
+               });
+    return *this;
+}
+
+} // namespace CedarFramework
@@ -0,0 +1,502 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the declaration of the serialized fields of a structure
+ */
+
+#pragma once
+
+// Cedar Framework includes
+#include <CedarFramework/Deserialization.hpp>
+#include <CedarFramework/Serialization.hpp>
+
+// Qt includes
+#include <QtCore/QJsonObject>
+
+// System includes
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <tuple>
+#include <utility>
+
+// Forward declarations
+
+// Macros
+
+/*!
+ * Declares the fields of a structure and generates its serialize() and deserialize() functions
+ *
+ * \param   Type    Structure type
+ * \param   ...     Names of the member variables (up to 32)
+ *
+ * The structure is serialized to a *JSON Object* with a member for each of the fields. During
+ * deserialization the *JSON Object* is iterated only once, all fields are required and unknown
+ * members are ignored.
+ *
+ * \note    The macro needs to be used in the global namespace
+ *
+ * Example:
+ *
+ * \code
+ * struct Point3D
+ * {
+ *     int x;
+ *     int y;
+ *     int z;
+ * };
+ *
+ * CEDARFRAMEWORK_FIELDS(Point3D, x, y, z)
+ * \endcode
+ */
+#define CEDARFRAMEWORK_FIELDS(Type, ...) \
+    namespace CedarFramework \
+    { \
+    template<> \
+    struct FieldTable<Type> \
+    { \
+        static constexpr auto members() \
+        { \
+            return std::make_tuple( \
+                    CEDARFRAMEWORK_FIELDS_MAP(CEDARFRAMEWORK_FIELDS_MEMBER, Type, __VA_ARGS__)); \
+        } \
+        \
+        static const QLatin1String *keys() \
+        { \
+            static constexpr QLatin1String table[] = { \
+                CEDARFRAMEWORK_FIELDS_MAP(CEDARFRAMEWORK_FIELDS_KEY, Type, __VA_ARGS__) \
+            }; \
+            return table; \
+        } \
+    }; \
+    \
+    template<> \
+    inline QJsonValue serialize(const Type &value) \
+    { \
+        return Internal::serializeFields(value); \
+    } \
+    \
+    template<> \
+    inline bool deserialize(const QJsonValue &json, Type *value) \
+    { \
+        return Internal::deserializeFields(json, value); \
+    } \
+    }
+
+//! Creates a member pointer for the field table
+#define CEDARFRAMEWORK_FIELDS_MEMBER(Type, name) &Type::name
+
+//! Creates a key for the field table
+#define CEDARFRAMEWORK_FIELDS_KEY(Type, name) \
+    QLatin1String(#name, static_cast<int>(sizeof(#name)) - 1)
+
+//! Applies the macro M to each of the fields
+#define CEDARFRAMEWORK_FIELDS_MAP(M, T, ...) \
+    CEDARFRAMEWORK_FIELDS_EXPAND( \
+            CEDARFRAMEWORK_FIELDS_CONCAT(CEDARFRAMEWORK_FIELDS_MAP_, \
+                                         CEDARFRAMEWORK_FIELDS_COUNT(__VA_ARGS__))(M, T, __VA_ARGS__))
+
+//! Expands the macro arguments (needed for the MSVC preprocessor)
+#define CEDARFRAMEWORK_FIELDS_EXPAND(x) x
+
+//! Concatenates the expanded macro arguments
+#define CEDARFRAMEWORK_FIELDS_CONCAT(a, b) CEDARFRAMEWORK_FIELDS_CONCAT_IMPL(a, b)
+
+//! Concatenates the macro arguments
+#define CEDARFRAMEWORK_FIELDS_CONCAT_IMPL(a, b) a ## b
+
+//! Selects the number of the fields
+#define CEDARFRAMEWORK_FIELDS_SELECT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, \
+        _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, \
+        _31, _32, N, ...) N
+
+#define CEDARFRAMEWORK_FIELDS_COUNT(...) \
+    CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_SELECT(__VA_ARGS__, \
+        32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, \
+        10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+
+#define CEDARFRAMEWORK_FIELDS_MAP_1(M, T, x) M(T, x)
+#define CEDARFRAMEWORK_FIELDS_MAP_2(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_1(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_3(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_2(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_4(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_3(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_5(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_4(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_6(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_5(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_7(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_6(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_8(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_7(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_9(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_8(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_10(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_9(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_11(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_10(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_12(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_11(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_13(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_12(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_14(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_13(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_15(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_14(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_16(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_15(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_17(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_16(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_18(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_17(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_19(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_18(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_20(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_19(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_21(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_20(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_22(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_21(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_23(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_22(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_24(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_23(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_25(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_24(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_26(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_25(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_27(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_26(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_28(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_27(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_29(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_28(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_30(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_29(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_31(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_30(M, T, __VA_ARGS__))
+#define CEDARFRAMEWORK_FIELDS_MAP_32(M, T, x, ...) \
+    M(T, x), CEDARFRAMEWORK_FIELDS_EXPAND(CEDARFRAMEWORK_FIELDS_MAP_31(M, T, __VA_ARGS__))
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+/*!
+ * Table of the serialized fields of a structure, generated by the CEDARFRAMEWORK_FIELDS() macro
+ *
+ * \tparam  T   Structure type
+ *
+ * The specializations contain:
+ *
+ * - static constexpr auto members(): returns a tuple with the member pointers of the fields
+ * - static const QLatin1String *keys(): returns the keys of the fields in the same order, the table
+ *   is a compile-time constant
+ */
+template<typename T>
+struct FieldTable;
+
+namespace Internal
+{
+
+/*!
+ * Serializes the structure to a JSON Object
+ *
+ * \tparam  T   Structure type
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+template<typename T>
+QJsonValue serializeFields(const T &value);
+
+/*!
+ * Deserializes the structure from a JSON Object
+ *
+ * \tparam  T   Structure type
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T>
+bool deserializeFields(const QJsonValue &json, T *value);
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+// Template definitions
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+/*!
+ * Gets the number of the fields of a structure
+ *
+ * \tparam  T   Structure type
+ *
+ * \return  Number of the fields
+ */
+template<typename T>
+constexpr int fieldCount()
+{
+    return static_cast<int>(std::tuple_size<decltype(FieldTable<T>::members())>::value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes a field of a structure
+ *
+ * \tparam  T   Structure type
+ * \tparam  I   Index of the field
+ *
+ * \param           value       Value to serialize
+ * \param[in,out]   jsonObject  JSON Object to which the field is inserted
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T, std::size_t I>
+bool serializeField(const T &value, QJsonObject *jsonObject)
+{
+    const QLatin1String key = FieldTable<T>::keys()[I];
+    const QJsonValue serializedField = serialize(value.*std::get<I>(FieldTable<T>::members()));
+
+    if (serializedField.isUndefined())
+    {
+        qCWarning(CedarFramework::LoggingCategory::Serialization)
+                << QStringLiteral("Failed to serialize the field:") << key;
+        return false;
+    }
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    jsonObject->insert(key, serializedField);
+#else
+    jsonObject->insert(QString(key), serializedField);
+#endif
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes a field of a structure
+ *
+ * \tparam  T   Structure type
+ * \tparam  I   Index of the field
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T, std::size_t I>
+bool deserializeField(const QJsonValue &json, T *value)
+{
+    return deserialize(json, &(value->*std::get<I>(FieldTable<T>::members())));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes all of the fields of a structure
+ *
+ * \tparam  T   Structure type
+ * \tparam  I   Indexes of the fields
+ *
+ * \param           value       Value to serialize
+ * \param[in,out]   jsonObject  JSON Object to which the fields are inserted
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T, std::size_t... I>
+bool serializeFields(const T &value, QJsonObject *jsonObject, std::index_sequence<I...>)
+{
+    using FieldSerializer = bool (*)(const T &, QJsonObject *);
+    static const FieldSerializer serializers[] = { &serializeField<T, I>... };
+
+    for (const FieldSerializer serializer : serializers)
+    {
+        if (!serializer(value, jsonObject))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the table with the deserialization functions of the fields of a structure
+ *
+ * \tparam  T   Structure type
+ * \tparam  I   Indexes of the fields
+ *
+ * \return  Deserialization functions of the fields in the same order as in the field table
+ */
+template<typename T, std::size_t... I>
+const auto *fieldDeserializers(std::index_sequence<I...>)
+{
+    using FieldDeserializer = bool (*)(const QJsonValue &, T *);
+    static const FieldDeserializer deserializers[] = { &deserializeField<T, I>... };
+    return deserializers;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the indexes of the fields of a structure sorted by their keys
+ *
+ * \tparam  T   Structure type
+ *
+ * \return  Indexes of the fields in the same order as the members of a JSON Object
+ */
+template<typename T>
+const std::array<int, fieldCount<T>()> &sortedFieldIndexes()
+{
+    static const std::array<int, fieldCount<T>()> indexes = []()
+    {
+        const QLatin1String *keys = FieldTable<T>::keys();
+        std::array<int, fieldCount<T>()> sortedIndexes;
+
+        for (int i = 0; i < fieldCount<T>(); i++)
+        {
+            sortedIndexes[static_cast<std::size_t>(i)] = i;
+        }
+
+        std::sort(sortedIndexes.begin(),
+                  sortedIndexes.end(),
+                  [keys](const int left, const int right) { return keys[left] < keys[right]; });
+
+        return sortedIndexes;
+    }();
+
+    return indexes;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+QJsonValue serializeFields(const T &value)
+{
+    QJsonObject jsonObject;
+
+    if (!serializeFields(value, &jsonObject, std::make_index_sequence<fieldCount<T>()>()))
+    {
+        return QJsonValue(QJsonValue::Undefined);
+    }
+
+    return jsonObject;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserializeFields(const QJsonValue &json, T *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    constexpr int count = fieldCount<T>();
+
+    // Get the JSON Object representation
+    if (!json.isObject())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not an Object:") << json;
+        return false;
+    }
+
+    const auto jsonObject = json.toObject();
+
+    // Deserialize the fields in a single merge pass over the members of the JSON Object and the
+    // fields sorted by their keys, the members of a JSON Object are also sorted by their keys
+    const QLatin1String *keys = FieldTable<T>::keys();
+    const auto &sortedFields = sortedFieldIndexes<T>();
+    const auto *deserializers = fieldDeserializers<T>(std::make_index_sequence<count>());
+    std::bitset<count> deserializedFields;
+    int position = 0;
+
+    for (auto it = jsonObject.begin(); (it != jsonObject.end()) && (position < count); it++)
+    {
+        // The key is compared directly with the keys of the fields (Qt 5 returns it by value)
+        const QString &key = it.key();
+        int order = 1;
+
+        // Skip the fields that sort before the member, they are missing in the JSON Object
+        for (; position < count; position++)
+        {
+            order = key.compare(keys[sortedFields[static_cast<std::size_t>(position)]]);
+
+            if (order <= 0)
+            {
+                break;
+            }
+        }
+
+        if (order != 0)
+        {
+            // Ignore unknown members
+            continue;
+        }
+
+        const int field = sortedFields[static_cast<std::size_t>(position)];
+        position++;
+
+        if (!deserializers[field](it.value(), value))
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, key)
+                    << QStringLiteral("Failed to deserialize the field:") << key;
+            return false;
+        }
+
+        deserializedFields.set(static_cast<std::size_t>(field));
+    }
+
+    // Check if all of the fields were deserialized
+    if (!deserializedFields.all())
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (!deserializedFields.test(static_cast<std::size_t>(i)))
+            {
+                CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::NodeNotFound,
+                                                     QString(keys[i]))
+                        << QStringLiteral("JSON Object doesn't contain the field:") << keys[i];
+                break;
+            }
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace Internal
+
+} // namespace CedarFramework
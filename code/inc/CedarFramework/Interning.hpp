@@ -0,0 +1,293 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the interning of the deserialized values that are expensive to parse
+ */
+
+#pragma once
+
+// Cedar Framework includes
+#include <CedarFramework/CedarFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QHash>
+#include <QtCore/QLocale>
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QUrl>
+
+// System includes
+#include <atomic>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+//! Statistics of an interning pool
+struct InterningStatistics
+{
+    //! Number of lookups that found an already interned value
+    quint64 hits;
+
+    //! Number of lookups that interned a new value
+    quint64 misses;
+
+    //! Size of the string data that was shared with an interned string instead of being kept again
+    quint64 savedBytes;
+};
+
+/*!
+ * Pool of interned values
+ *
+ * While a pool is active (see InterningScope) the QLocale and QUrl values are not parsed again for
+ * an input that was already deserialized, instead the value in the pool is looked up and shared.
+ * The deserialized QString values and the QString keys of the maps share their storage with the
+ * equal string in the pool, so repeated content (for example enum-like values and keys) is kept in
+ * memory only once. The values are kept until the pool is cleared or destroyed.
+ *
+ * The number of interned values is limited by the capacity of the pool (65536 values by default).
+ * Once the pool is full the values that are not interned yet are parsed and returned without being
+ * added to the pool, so a document with many unique values can't grow the pool without a bound. The
+ * already interned values are still shared.
+ *
+ * Each thread keeps the values that it already looked up in a small front cache of the pool that
+ * it used last, so the repeated lookups don't take the lock of the shared pool. Clearing the pool
+ * invalidates the front caches of all the threads.
+ *
+ * \note    The methods of the pool are thread-safe, so the same pool can be active in multiple
+ *          threads
+ */
+class CEDARFRAMEWORK_EXPORT InterningPool
+{
+public:
+    //! Constructor
+    InterningPool();
+
+    /*!
+     * Constructor
+     *
+     * \param   capacity    Maximum number of interned values (0 disables the interning)
+     */
+    explicit InterningPool(const int capacity);
+
+    //! Copy constructor is disabled
+    InterningPool(const InterningPool &) = delete;
+
+    //! Copy assignment operator is disabled
+    InterningPool &operator=(const InterningPool &) = delete;
+
+    /*!
+     * Gets the process-wide pool
+     *
+     * \return  Process-wide pool
+     */
+    static InterningPool &global();
+
+    /*!
+     * Gets the interned locale
+     *
+     * \param   name    Name of the locale
+     *
+     * \return  Same locale as QLocale(name)
+     */
+    QLocale locale(const QString &name);
+
+    /*!
+     * Gets the interned URL
+     *
+     * \param   url     String representation of the URL
+     *
+     * \return  Same URL as QUrl(url)
+     */
+    QUrl url(const QString &url);
+
+    /*!
+     * Gets the interned string
+     *
+     * \param   value   String
+     *
+     * \return  String equal to the value that shares its storage with the interned string
+     *
+     * \note    Empty strings and strings longer than 64 characters are returned as they are, they
+     *          are not worth interning or are unlikely to be repeated
+     */
+    QString string(const QString &value);
+
+    /*!
+     * Gets the number of interned values
+     *
+     * \return  Number of interned values
+     */
+    int size() const;
+
+    /*!
+     * Gets the maximum number of interned values
+     *
+     * \return  Capacity of the pool
+     */
+    int capacity() const;
+
+    /*!
+     * Sets the maximum number of interned values
+     *
+     * \param   capacity    Maximum number of interned values (0 disables the interning)
+     *
+     * \note    The already interned values are kept even if there are more of them than the new
+     *          capacity, in that case no new values are interned until the pool is cleared
+     */
+    void setCapacity(const int capacity);
+
+    /*!
+     * Gets the statistics of the lookups
+     *
+     * \return  Statistics
+     */
+    InterningStatistics statistics() const;
+
+    //! Removes all the interned values and resets the statistics
+    void clear();
+
+private:
+    /*!
+     * Gets the number of interned values without locking
+     *
+     * \return  Number of interned values
+     */
+    int internedCount() const;
+
+    /*!
+     * Counts a lookup
+     *
+     * \param   hit         Flag that indicates if the value was already interned
+     * \param   savedBytes  Size of the data that was shared with the interned value
+     */
+    void countLookup(bool hit, quint64 savedBytes);
+
+    //! Number of the lookup counter shards
+    static constexpr int counterShardCount = 16;
+
+    //! Lookup counters of a group of threads, padded to a cache line so that the threads that count
+    //! in different shards don't contend for it
+    struct CounterShard
+    {
+        //! Number of lookups that found an already interned value
+        std::atomic<quint64> hits;
+
+        //! Number of lookups that interned a new value
+        std::atomic<quint64> misses;
+
+        //! Size of the shared string data
+        std::atomic<quint64> savedBytes;
+
+        //! Padding to the size of a cache line
+        char padding[64 - (3 * sizeof(std::atomic<quint64>))];
+    };
+
+    //! Lock for the interned values and the capacity
+    mutable QReadWriteLock m_lock;
+
+    //! Maximum number of interned values
+    int m_capacity;
+
+    //! Generation of the interned values, unique across all the pools and changed when the pool is
+    //! cleared so that the front caches of the threads are invalidated
+    std::atomic<quint64> m_generation;
+
+    //! Interned locales
+    QHash<QString, QLocale> m_locales;
+
+    //! Interned URLs
+    QHash<QString, QUrl> m_urls;
+
+    //! Interned strings
+    QHash<QString, QString> m_strings;
+
+    //! Lookup counters, each thread counts in one of the shards
+    CounterShard m_counterShards[counterShardCount];
+};
+
+namespace Internal
+{
+
+#ifdef Q_OS_WIN
+/*!
+ * Gets the interning pool that is active in the current thread
+ *
+ * \return  Active interning pool or a null pointer if no pool is active
+ *
+ * \note    Thread-local variables can't be exported from a DLL, so the pool is read through a
+ *          function call
+ */
+CEDARFRAMEWORK_EXPORT InterningPool *currentInterningPool();
+#else
+//! Interning pool that is active in the current thread
+extern CEDARFRAMEWORK_EXPORT thread_local InterningPool *activeInterningPool;
+#endif
+
+} // namespace Internal
+
+/*!
+ * Gets the interning pool that is active in the current thread
+ *
+ * \return  Active interning pool or a null pointer if no pool is active
+ *
+ * \note    By default no pool is active
+ */
+inline InterningPool *activeInterningPool()
+{
+#ifdef Q_OS_WIN
+    return Internal::currentInterningPool();
+#else
+    return Internal::activeInterningPool;
+#endif
+}
+
+/*!
+ * Activates an interning pool in the current thread for the lifetime of the object
+ *
+ * A pool created for a single deserialization context limits the interned values to that context
+ * while the process-wide pool (InterningPool::global()) shares them across the whole process.
+ */
+class CEDARFRAMEWORK_EXPORT InterningScope
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   pool    Interning pool to activate
+     */
+    explicit InterningScope(InterningPool &pool);
+
+    //! Destructor, restores the previously active interning pool
+    ~InterningScope();
+
+    //! Copy constructor is disabled
+    InterningScope(const InterningScope &) = delete;
+
+    //! Copy assignment operator is disabled
+    InterningScope &operator=(const InterningScope &) = delete;
+
+private:
+    //! Previously active interning pool
+    InterningPool *m_previousPool;
+};
+
+} // namespace CedarFramework
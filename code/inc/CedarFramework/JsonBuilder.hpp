@@ -0,0 +1,87 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the builder used to construct large JSON Objects efficiently
+ */
+
+#pragma once
+
+// Cedar Framework includes
+#include <CedarFramework/CedarFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QJsonObject>
+#include <QtCore/QPair>
+#include <QtCore/QVector>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+/*!
+ * Collects the members of a JSON Object and then constructs it with the members sorted by their
+ * keys
+ *
+ * A JSON Object keeps its members sorted by their keys, so inserting a member with a key that is
+ * not the greatest one moves all the members that follow it. Inserting the members of an unordered
+ * container (or of a container whose keys are not sorted in the same way as the serialized keys)
+ * one at a time therefore takes quadratic time. The builder sorts the collected members once and
+ * then always inserts them at the end of the JSON Object.
+ *
+ * \note    If the same key is inserted more than once the last inserted value is used, the same as
+ *          with QJsonObject::insert()
+ */
+class CEDARFRAMEWORK_EXPORT JsonObjectBuilder
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   size    Expected number of members
+     */
+    explicit JsonObjectBuilder(int size = 0);
+
+    /*!
+     * Adds a member
+     *
+     * \param   key     Key
+     * \param   value   Value
+     */
+    void insert(const QString &key, const QJsonValue &value);
+
+    /*!
+     * Constructs the JSON Object from the added members
+     *
+     * \return  JSON Object
+     *
+     * \note    The added members are cleared
+     */
+    QJsonObject toObject();
+
+private:
+    //! Added members
+    QVector<QPair<QString, QJsonValue>> m_members;
+};
+
+} // namespace CedarFramework
@@ -0,0 +1,143 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains methods used for serialization and deserialization of the properties of Q_GADGET and
+ * QObject types
+ */
+
+#pragma once
+
+// Cedar Framework includes
+#include <CedarFramework/CedarFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QJsonValue>
+#include <QtCore/QMetaObject>
+#include <QtCore/QObject>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+/*!
+ * Serializes the properties of a Q_GADGET value
+ *
+ * \param   gadget      Pointer to the Q_GADGET value
+ * \param   metaObject  Meta-object of the Q_GADGET type
+ *
+ * \return  Serialized value (*JSON Object* with a member for each of the stored properties) or
+ *          QJsonValue::Undefined in case of an error
+ *
+ * \note    Enumeration properties are serialized with the names of their values
+ */
+CEDARFRAMEWORK_EXPORT QJsonValue serializeGadget(const void *gadget, const QMetaObject &metaObject);
+
+/*!
+ * Deserializes the properties of a Q_GADGET value
+ *
+ * \param       json        JSON value
+ * \param[out]  gadget      Pointer to the Q_GADGET value
+ * \param       metaObject  Meta-object of the Q_GADGET type
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    Properties without a member in the *JSON Object* are left unchanged and members
+ *          without a writable property are ignored
+ */
+CEDARFRAMEWORK_EXPORT bool deserializeGadget(const QJsonValue &json,
+                                             void *gadget,
+                                             const QMetaObject &metaObject);
+
+/*!
+ * Serializes the properties of a QObject
+ *
+ * \param   object  Object to serialize
+ *
+ * \return  Serialized value (*JSON Object* with a member for each of the stored properties, except
+ *          for the ones declared in QObject) or QJsonValue::Undefined in case of an error
+ */
+CEDARFRAMEWORK_EXPORT QJsonValue serializeObject(const QObject &object);
+
+/*!
+ * Deserializes the properties of a QObject
+ *
+ * \param       json    JSON value
+ * \param[out]  object  Object to deserialize
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    Properties without a member in the *JSON Object* are left unchanged and members
+ *          without a writable property are ignored
+ */
+CEDARFRAMEWORK_EXPORT bool deserializeObject(const QJsonValue &json, QObject *object);
+
+/*!
+ * Serializes the properties of a Q_GADGET value
+ *
+ * \tparam  T   Q_GADGET type
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+template<typename T>
+QJsonValue serializeGadget(const T &value);
+
+/*!
+ * Deserializes the properties of a Q_GADGET value
+ *
+ * \tparam  T   Q_GADGET type
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T>
+bool deserializeGadget(const QJsonValue &json, T *value);
+
+// -------------------------------------------------------------------------------------------------
+// Template definitions
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+QJsonValue serializeGadget(const T &value)
+{
+    return serializeGadget(static_cast<const void *>(&value), T::staticMetaObject);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserializeGadget(const QJsonValue &json, T *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    return deserializeGadget(json, static_cast<void *>(value), T::staticMetaObject);
+}
+
+} // namespace CedarFramework
@@ -0,0 +1,149 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the registration of the derived types of a polymorphic base type
+ */
+
+#pragma once
+
+// Cedar Framework includes
+#include <CedarFramework/Deserialization.hpp>
+#include <CedarFramework/Serialization.hpp>
+#include <CedarFramework/TypeTag.hpp>
+
+// Qt includes
+
+// System includes
+#include <type_traits>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+/*!
+ * Registers a derived type so that it can be serialized and deserialized through a
+ * std::unique_ptr or std::shared_ptr to the base type
+ *
+ * \tparam  Base    Base type
+ * \tparam  Derived Derived type
+ *
+ * \param   tag     Type tag that is written to the JSON representation of the derived type
+ *
+ * \note    The derived type needs to have a default constructor and its own serialize() and
+ *          deserialize() specializations
+ *
+ * \note    The type tag must be unique among the types derived from the base type, registering the
+ *          derived type again replaces its previous type tag
+ */
+template<typename Base, typename Derived>
+void registerPolymorphicType(const QString &tag);
+
+/*!
+ * Registers a derived type with the type tag declared with CEDARFRAMEWORK_TYPE_TAG()
+ *
+ * \tparam  Base    Base type
+ * \tparam  Derived Derived type
+ */
+template<typename Base, typename Derived>
+void registerPolymorphicType();
+
+// -------------------------------------------------------------------------------------------------
+// Template definitions
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+/*!
+ * Serializes the derived type through a reference to the base type
+ *
+ * \tparam  Base    Base type
+ * \tparam  Derived Derived type
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+template<typename Base, typename Derived>
+QJsonValue serializeDerived(const Base &value)
+{
+    return serialize(static_cast<const Derived &>(value));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Creates and deserializes the derived type
+ *
+ * \tparam  Base    Base type
+ * \tparam  Derived Derived type
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename Base, typename Derived>
+bool deserializeDerived(const QJsonValue &json, std::unique_ptr<Base> *value)
+{
+    auto derivedValue = std::make_unique<Derived>();
+
+    if (!deserialize(json, derivedValue.get()))
+    {
+        return false;
+    }
+
+    *value = std::move(derivedValue);
+    return true;
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename Base, typename Derived>
+void registerPolymorphicType(const QString &tag)
+{
+    static_assert(std::is_base_of<Base, Derived>::value, "Derived needs to be derived from Base!");
+    static_assert(std::is_polymorphic<Base>::value, "Base needs to be a polymorphic type!");
+
+    typename Internal::PolymorphicTypeRegistry<Base>::Entry entry;
+    entry.tag = tag;
+    entry.serializer = &Internal::serializeDerived<Base, Derived>;
+    entry.factory = &Internal::deserializeDerived<Base, Derived>;
+
+    const bool added = Internal::PolymorphicTypeRegistry<Base>::instance().add(
+                           std::type_index(typeid(Derived)), entry);
+    Q_ASSERT_X(added, "registerPolymorphicType", "Type tag is already registered");
+    Q_UNUSED(added);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename Base, typename Derived>
+void registerPolymorphicType()
+{
+    registerPolymorphicType<Base, Derived>(TypeTag<Derived>::name());
+}
+
+} // namespace CedarFramework
@@ -0,0 +1,116 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the cache of the compiled regular expressions
+ */
+
+#pragma once
+
+// Cedar Framework includes
+#include <CedarFramework/CedarFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QRegExp>
+#include <QtCore/QRegularExpression>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+//! Statistics of the regular expression cache
+struct RegularExpressionCacheStatistics
+{
+    //! Number of lookups that found the regular expression in the cache
+    quint64 hits = 0;
+
+    //! Number of lookups that had to create the regular expression
+    quint64 misses = 0;
+
+    //! Number of cached regular expressions
+    int size = 0;
+
+    //! Maximum number of cached regular expressions
+    int capacity = 0;
+};
+
+/*!
+ * Gets a QRegularExpression from the process-wide cache
+ *
+ * \param   pattern Pattern
+ * \param   options Pattern options
+ *
+ * \return  Regular expression
+ *
+ * If the regular expression is not cached yet it is created, optimized (compiled) and added to
+ * the cache. When the cache is full the least recently used regular expression is removed from it.
+ * The returned regular expression shares its compiled pattern with the cached one.
+ *
+ * \note    This method is thread-safe
+ */
+CEDARFRAMEWORK_EXPORT QRegularExpression cachedRegularExpression(
+        const QString &pattern,
+        const QRegularExpression::PatternOptions options = QRegularExpression::NoPatternOption);
+
+/*!
+ * Gets a QRegExp from the process-wide cache
+ *
+ * \param   pattern         Pattern
+ * \param   caseSensitivity Case sensitivity
+ * \param   syntax          Pattern syntax
+ *
+ * \return  Regular expression
+ *
+ * The regular expressions are cached the same way as with cachedRegularExpression().
+ *
+ * \note    This method is thread-safe
+ */
+CEDARFRAMEWORK_EXPORT QRegExp cachedRegExp(const QString &pattern,
+                                           const Qt::CaseSensitivity caseSensitivity,
+                                           const QRegExp::PatternSyntax syntax);
+
+/*!
+ * Sets the maximum number of regular expressions in the cache
+ *
+ * \param   capacity    Maximum number of cached regular expressions (0 disables the cache)
+ *
+ * The default capacity is 4096 regular expressions.
+ *
+ * \note    The least recently used regular expressions are removed if the cache holds more of them
+ *          than the new capacity
+ */
+CEDARFRAMEWORK_EXPORT void setRegularExpressionCacheCapacity(const int capacity);
+
+/*!
+ * Removes all the regular expressions from the cache and resets its statistics
+ */
+CEDARFRAMEWORK_EXPORT void clearRegularExpressionCache();
+
+/*!
+ * Gets the statistics of the regular expression cache
+ *
+ * \return  Statistics
+ */
+CEDARFRAMEWORK_EXPORT RegularExpressionCacheStatistics regularExpressionCacheStatistics();
+
+} // namespace CedarFramework
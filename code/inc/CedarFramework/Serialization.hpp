@@ -21,14 +21,23 @@
 #pragma once
 
 // Cedar Framework includes
+#include <CedarFramework/Encoding.hpp>
+#include <CedarFramework/JsonBuilder.hpp>
 #include <CedarFramework/LoggingCategories.hpp>
+#include <CedarFramework/TypeTag.hpp>
 
 // Qt includes
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
+#include <QtCore/QVarLengthArray>
 
 // System includes
+#include <array>
+#include <deque>
+#include <set>
+#include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 
 // Forward declarations
 
@@ -247,6 +256,61 @@ template<>
 CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QCborSimpleType &value);
 #endif
 
+/*!
+ * Serializes the value of a trivial type
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value
+ *
+ * \note    These inline overloads are preferred over the exported specializations (for example for
+ *          the items of the containers) so that the serialization can be inlined. Both produce the
+ *          same result.
+ */
+inline QJsonValue serialize(const bool &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const signed char &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const unsigned char &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const short &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const unsigned short &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const int &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const unsigned int &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const long &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const unsigned long &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const long long &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const unsigned long long &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const float &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const double &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const QChar &value);
+
+//! \copydoc    CedarFramework::serialize(const bool &)
+inline QJsonValue serialize(const QString &value);
+
 //! \copydoc    CedarFramework::serialize()
 template<typename T1, typename T2>
 QJsonValue serialize(const QPair<T1, T2> &value);
@@ -275,6 +339,26 @@ QJsonValue serialize(const std::vector<T> &value);
 template<typename T>
 QJsonValue serialize(const QSet<T> &value);
 
+//! \copydoc    CedarFramework::serialize()
+template<typename T, int Prealloc>
+QJsonValue serialize(const QVarLengthArray<T, Prealloc> &value);
+
+//! \copydoc    CedarFramework::serialize()
+template<typename T>
+QJsonValue serialize(const std::deque<T> &value);
+
+//! \copydoc    CedarFramework::serialize()
+template<typename T, std::size_t N>
+QJsonValue serialize(const std::array<T, N> &value);
+
+//! \copydoc    CedarFramework::serialize()
+template<typename T>
+QJsonValue serialize(const std::set<T> &value);
+
+//! \copydoc    CedarFramework::serialize()
+template<typename T>
+QJsonValue serialize(const std::unordered_set<T> &value);
+
 //! \copydoc    CedarFramework::serialize()
 template<typename K, typename V>
 QJsonValue serialize(const QMap<K, V> &value);
@@ -299,6 +383,42 @@ QJsonValue serialize(const QMultiMap<K, V> &value);
 template<typename K, typename V>
 QJsonValue serialize(const QMultiHash<K, V> &value);
 
+/*!
+ * Serializes the polymorphic value together with the type tag of its derived type
+ *
+ * \tparam  T   Base type
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value (*JSON Object* with "type" and "value" members or *JSON Null* for a
+ *          null pointer) or QJsonValue::Undefined in case of an error
+ *
+ * \note    The derived type needs to be registered with registerPolymorphicType()
+ */
+template<typename T>
+QJsonValue serialize(const std::unique_ptr<T> &value);
+
+//! \copydoc    CedarFramework::serialize(const std::unique_ptr<T> &)
+template<typename T>
+QJsonValue serialize(const std::shared_ptr<T> &value);
+
+#ifdef CEDARFRAMEWORK_HAS_STD_VARIANT
+/*!
+ * Serializes the std::variant value together with the type tag of the held alternative
+ *
+ * \tparam  T   Alternative types
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value (*JSON Object* with "type" and "value" members) or
+ *          QJsonValue::Undefined in case of an error
+ *
+ * \note    Type tags of all alternatives need to be declared with CEDARFRAMEWORK_TYPE_TAG()
+ */
+template<typename... T>
+QJsonValue serialize(const std::variant<T...> &value);
+#endif
+
 /*!
  * Helper method for that serializes the key value to a string so that it can be used in a JSON
  * object
@@ -317,13 +437,253 @@ QJsonValue serialize(const QMultiHash<K, V> &value);
 template<typename T>
 QString serializeKey(const T &value, bool *ok);
 
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const signed char &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const unsigned char &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const short &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const unsigned short &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const int &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const unsigned int &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const long &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const unsigned long &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const long long &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const unsigned long long &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const QString &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const std::string &value, bool *ok);
+
+//! \copydoc    CedarFramework::serializeKey()
+template<>
+CEDARFRAMEWORK_EXPORT QString serializeKey(const QUuid &value, bool *ok);
+
+/*!
+ * Serializes the value with the specified encoding profile
+ *
+ * \tparam  T   Value type
+ *
+ * \param   value   Value to serialize
+ * \param   profile Encoding profile to use
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+template<typename T>
+QJsonValue serialize(const T &value, const EncodingProfile &profile);
+
 // -------------------------------------------------------------------------------------------------
 // Template definitions
 // -------------------------------------------------------------------------------------------------
 
+namespace Internal
+{
+
+/*!
+ * Serializes an integer value that fits in a *JSON Number* without loss of precision
+ *
+ * \tparam  T   Integer type
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value
+ */
+template<typename T, std::enable_if_t<(sizeof(T) <= 4), bool> = true>
+QJsonValue serializeIntegerValue(const T &value)
+{
+    return static_cast<qint64>(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes a 64-bit integer value
+ *
+ * \tparam  T   Integer type
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value
+ */
+template<typename T, std::enable_if_t<(sizeof(T) == 8), bool> = true>
+QJsonValue serializeIntegerValue(const T &value)
+{
+    // Store the value as integer if it can be stored without loss of precision, otherwise store it
+    // as a string
+
+    // Check if input value is signed
+    if (std::is_signed<T>::value)
+    {
+        constexpr T upperLimit  = static_cast<T>( 9007199254740992LL);
+        constexpr T lowwerLimit = static_cast<T>(-9007199254740992LL);
+
+        if ((lowwerLimit <= value) && (value <= upperLimit))
+        {
+            return static_cast<qint64>(value);
+        }
+
+        return QString::number(value);
+    }
+    else
+    {
+        constexpr T limit  = static_cast<T>(9007199254740992ULL);
+
+        if (value <= limit)
+        {
+            return static_cast<qint64>(value);
+        }
+
+        return QString::number(value);
+    }
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const bool &value)
+{
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const signed char &value)
+{
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const unsigned char &value)
+{
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const short &value)
+{
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const unsigned short &value)
+{
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const int &value)
+{
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const unsigned int &value)
+{
+    return static_cast<qint64>(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const long &value)
+{
+    return Internal::serializeIntegerValue(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const unsigned long &value)
+{
+    return Internal::serializeIntegerValue(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const long long &value)
+{
+    return Internal::serializeIntegerValue(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const unsigned long long &value)
+{
+    return Internal::serializeIntegerValue(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const float &value)
+{
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const double &value)
+{
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const QChar &value)
+{
+    return QString(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline QJsonValue serialize(const QString &value)
+{
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename T1, typename T2>
 QJsonValue serialize(const QPair<T1, T2> &value)
 {
+    if (activeEncodingProfile().pair == Encoding::Compact)
+    {
+        return QJsonArray { serialize(value.first), serialize(value.second) };
+    }
+
     return QJsonObject {
         { QStringLiteral("first"), serialize(value.first) },
         { QStringLiteral("second"), serialize(value.second) }
@@ -335,6 +695,11 @@ QJsonValue serialize(const QPair<T1, T2> &value)
 template<typename T1, typename T2>
 QJsonValue serialize(const std::pair<T1, T2> &value)
 {
+    if (activeEncodingProfile().pair == Encoding::Compact)
+    {
+        return QJsonArray { serialize(value.first), serialize(value.second) };
+    }
+
     return QJsonObject {
         { QStringLiteral("first"), serialize(value.first) },
         { QStringLiteral("second"), serialize(value.second) }
@@ -343,20 +708,34 @@ QJsonValue serialize(const std::pair<T1, T2> &value)
 
 // -------------------------------------------------------------------------------------------------
 
-template<typename T>
-QJsonValue serialize(const QList<T> &value)
+namespace Internal
+{
+
+/*!
+ * Serializes the items of a sequence or set container
+ *
+ * \tparam  C   Container type
+ *
+ * \param   value       Value to serialize
+ * \param   itemName    Name of the container items used in the warnings
+ *
+ * \return  Serialized value (*JSON Array*) or QJsonValue::Undefined in case of an error
+ */
+template<typename C>
+QJsonValue serializeSequence(const C &value, const char *itemName)
 {
     QJsonArray array;
     int index = 0;
 
-    for (const T &item : value)
+    for (const auto &item : value)
     {
         const QJsonValue serializedItem = serialize(item);
 
         if (serializedItem.isUndefined())
         {
             qCWarning(CedarFramework::LoggingCategory::Serialization)
-                    << QStringLiteral("Failed to serialize list item at index:") << index;
+                    << QString("Failed to serialize %1 item at index:").arg(QLatin1String(itemName))
+                    << index;
             return QJsonValue(QJsonValue::Undefined);
         }
 
@@ -367,30 +746,22 @@ QJsonValue serialize(const QList<T> &value)
     return array;
 }
 
+} // namespace Internal
+
 // -------------------------------------------------------------------------------------------------
 
 template<typename T>
-QJsonValue serialize(const std::list<T> &value)
+QJsonValue serialize(const QList<T> &value)
 {
-    QJsonArray array;
-    int index = 0;
-
-    for (const T &item : value)
-    {
-        const QJsonValue serializedItem = serialize(item);
-
-        if (serializedItem.isUndefined())
-        {
-            qCWarning(CedarFramework::LoggingCategory::Serialization)
-                    << QStringLiteral("Failed to serialize list item at index:") << index;
-            return QJsonValue(QJsonValue::Undefined);
-        }
+    return Internal::serializeSequence(value, "list");
+}
 
-        array.append(serializedItem);
-        index++;
-    }
+// -------------------------------------------------------------------------------------------------
 
-    return array;
+template<typename T>
+QJsonValue serialize(const std::list<T> &value)
+{
+    return Internal::serializeSequence(value, "list");
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -398,25 +769,7 @@ QJsonValue serialize(const std::list<T> &value)
 template<typename T>
 QJsonValue serialize(const QVector<T> &value)
 {
-    QJsonArray array;
-    int index = 0;
-
-    for (const T &item : value)
-    {
-        const QJsonValue serializedItem = serialize(item);
-
-        if (serializedItem.isUndefined())
-        {
-            qCWarning(CedarFramework::LoggingCategory::Serialization)
-                    << QStringLiteral("Failed to serialize vector item at index:") << index;
-            return QJsonValue(QJsonValue::Undefined);
-        }
-
-        array.append(serializedItem);
-        index++;
-    }
-
-    return array;
+    return Internal::serializeSequence(value, "vector");
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -424,49 +777,55 @@ QJsonValue serialize(const QVector<T> &value)
 template<typename T>
 QJsonValue serialize(const std::vector<T> &value)
 {
-    QJsonArray array;
-    int index = 0;
+    return Internal::serializeSequence(value, "vector");
+}
 
-    for (const T &item : value)
-    {
-        const QJsonValue serializedItem = serialize(item);
+// -------------------------------------------------------------------------------------------------
 
-        if (serializedItem.isUndefined())
-        {
-            qCWarning(CedarFramework::LoggingCategory::Serialization)
-                    << QStringLiteral("Failed to serialize vector item at index:") << index;
-            return QJsonValue(QJsonValue::Undefined);
-        }
+template<typename T>
+QJsonValue serialize(const QSet<T> &value)
+{
+    return Internal::serializeSequence(value, "set");
+}
 
-        array.append(serializedItem);
-        index++;
-    }
+// -------------------------------------------------------------------------------------------------
 
-    return array;
+template<typename T, int Prealloc>
+QJsonValue serialize(const QVarLengthArray<T, Prealloc> &value)
+{
+    return Internal::serializeSequence(value, "array");
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename T>
-QJsonValue serialize(const QSet<T> &value)
+QJsonValue serialize(const std::deque<T> &value)
 {
-    QJsonArray array;
+    return Internal::serializeSequence(value, "deque");
+}
 
-    for (const T &item : value)
-    {
-        const QJsonValue serializedItem = serialize(item);
+// -------------------------------------------------------------------------------------------------
 
-        if (serializedItem.isUndefined())
-        {
-            qCWarning(CedarFramework::LoggingCategory::Serialization)
-                    << QStringLiteral("Failed to serialize set item");
-            return QJsonValue(QJsonValue::Undefined);
-        }
+template<typename T, std::size_t N>
+QJsonValue serialize(const std::array<T, N> &value)
+{
+    return Internal::serializeSequence(value, "array");
+}
 
-        array.append(serializedItem);
-    }
+// -------------------------------------------------------------------------------------------------
 
-    return array;
+template<typename T>
+QJsonValue serialize(const std::set<T> &value)
+{
+    return Internal::serializeSequence(value, "set");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+QJsonValue serialize(const std::unordered_set<T> &value)
+{
+    return Internal::serializeSequence(value, "set");
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -474,7 +833,7 @@ QJsonValue serialize(const QSet<T> &value)
 template<typename K, typename V>
 QJsonValue serialize(const QMap<K, V> &value)
 {
-    QJsonObject object;
+    JsonObjectBuilder object(static_cast<int>(value.size()));
 
     for (auto it = value.cbegin(); it != value.cend(); it++)
     {
@@ -503,7 +862,7 @@ QJsonValue serialize(const QMap<K, V> &value)
         object.insert(serializedKey, serializedValue);
     }
 
-    return object;
+    return object.toObject();
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -511,7 +870,7 @@ QJsonValue serialize(const QMap<K, V> &value)
 template<typename K, typename V>
 QJsonValue serialize(const std::map<K, V> &value)
 {
-    QJsonObject object;
+    JsonObjectBuilder object(static_cast<int>(value.size()));
 
     for (const auto &it : value)
     {
@@ -540,7 +899,7 @@ QJsonValue serialize(const std::map<K, V> &value)
         object.insert(serializedKey, serializedValue);
     }
 
-    return object;
+    return object.toObject();
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -548,7 +907,7 @@ QJsonValue serialize(const std::map<K, V> &value)
 template<typename K, typename V>
 QJsonValue serialize(const QHash<K, V> &value)
 {
-    QJsonObject object;
+    JsonObjectBuilder object(static_cast<int>(value.size()));
 
     for (auto it = value.cbegin(); it != value.cend(); it++)
     {
@@ -577,7 +936,7 @@ QJsonValue serialize(const QHash<K, V> &value)
         object.insert(serializedKey, serializedValue);
     }
 
-    return object;
+    return object.toObject();
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -585,7 +944,7 @@ QJsonValue serialize(const QHash<K, V> &value)
 template<typename K, typename V>
 QJsonValue serialize(const std::unordered_map<K, V> &value)
 {
-    QJsonObject object;
+    JsonObjectBuilder object(static_cast<int>(value.size()));
 
     for (const auto &it : value)
     {
@@ -614,19 +973,71 @@ QJsonValue serialize(const std::unordered_map<K, V> &value)
         object.insert(serializedKey, serializedValue);
     }
 
-    return object;
+    return object.toObject();
 }
 
 // -------------------------------------------------------------------------------------------------
 
+namespace Internal
+{
+
+/*!
+ * Checks if the key of the item that follows in the iteration is the same as the current key
+ *
+ * \tparam  K   Key type
+ * \tparam  V   Value type
+ *
+ * \param   container   Container
+ * \param   currentKey  Current key
+ * \param   nextKey     Key of the item that follows
+ *
+ * \retval  true    Keys are the same
+ * \retval  false   Keys are not the same
+ *
+ * \note    The items of a multi map are sorted, so the next key is never less than the current one
+ *          and only the operator< that the container requires is needed
+ */
 template<typename K, typename V>
-QJsonValue serialize(const QMultiMap<K, V> &value)
+bool isSameKey(const QMultiMap<K, V> &container, const K &currentKey, const K &nextKey)
+{
+    Q_UNUSED(container);
+    return !(currentKey < nextKey);
+}
+
+//! \copydoc    CedarFramework::Internal::isSameKey()
+template<typename K, typename V>
+bool isSameKey(const QMultiHash<K, V> &container, const K &currentKey, const K &nextKey)
+{
+    Q_UNUSED(container);
+    return currentKey == nextKey;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes a multi map container
+ *
+ * \tparam  C   Container type
+ *
+ * \param   value           Value to serialize
+ * \param   containerName   Name of the container used in the warning messages
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ *
+ * \note    The items with the same key are stored next to each other in the container so they are
+ *          serialized to a JSON Array in a single pass over the container, without creating a list
+ *          of the unique keys and a list of the values for each of them
+ */
+template<typename C>
+QJsonValue serializeMultiMap(const C &value, const char *containerName)
 {
-    QJsonObject object;
+    JsonObjectBuilder object;
+    auto it = value.cbegin();
 
-    for (const auto &key : value.uniqueKeys())
+    while (it != value.cend())
     {
         // Serialize key
+        const auto &key = it.key();
         bool ok = false;
         const QString serializedKey = serializeKey(key, &ok);
 
@@ -637,21 +1048,46 @@ QJsonValue serialize(const QMultiMap<K, V> &value)
             return QJsonValue(QJsonValue::Undefined);
         }
 
-        // Serialize value
-        const QJsonValue serializedValue = serialize(value.values(key));
+        // Serialize all values with the same key
+        QJsonArray array;
+        int index = 0;
 
-        if (serializedValue.isUndefined())
+        do
         {
-            qCWarning(CedarFramework::LoggingCategory::Serialization)
-                    << QStringLiteral("Failed to serialize the item's value with key:")
-                    << serializedKey;
-            return QJsonValue(QJsonValue::Undefined);
+            const QJsonValue serializedItem = serialize(it.value());
+
+            if (serializedItem.isUndefined())
+            {
+                qCWarning(CedarFramework::LoggingCategory::Serialization)
+                        << QString("Failed to serialize %1 item at index:")
+                           .arg(QLatin1String(containerName))
+                        << index;
+                qCWarning(CedarFramework::LoggingCategory::Serialization)
+                        << QStringLiteral("Failed to serialize the item's value with key:")
+                        << serializedKey;
+                return QJsonValue(QJsonValue::Undefined);
+            }
+
+            array.append(serializedItem);
+            index++;
+            it++;
         }
+        while ((it != value.cend()) && isSameKey(value, key, it.key()));
 
-        object.insert(serializedKey, serializedValue);
+        object.insert(serializedKey, array);
     }
 
-    return object;
+    return object.toObject();
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename K, typename V>
+QJsonValue serialize(const QMultiMap<K, V> &value)
+{
+    return Internal::serializeMultiMap(value, "multi map");
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -659,37 +1095,150 @@ QJsonValue serialize(const QMultiMap<K, V> &value)
 template<typename K, typename V>
 QJsonValue serialize(const QMultiHash<K, V> &value)
 {
-    QJsonObject object;
+    return Internal::serializeMultiMap(value, "multi hash");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
 
-    for (const auto &key : value.uniqueKeys())
+/*!
+ * Serializes the polymorphic value together with the type tag of its derived type
+ *
+ * \tparam  T   Base type
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+template<typename T>
+QJsonValue serializePolymorphic(const T &value)
+{
+    typename PolymorphicTypeRegistry<T>::Entry entry;
+
+    if (!PolymorphicTypeRegistry<T>::instance().find(std::type_index(typeid(value)), &entry))
     {
-        // Serialize key
-        bool ok = false;
-        const QString serializedKey = serializeKey(key, &ok);
+        qCWarning(CedarFramework::LoggingCategory::Serialization)
+                << QStringLiteral("No derived type is registered for the type:")
+                << typeid(value).name();
+        return QJsonValue(QJsonValue::Undefined);
+    }
 
-        if (!ok)
-        {
-            qCWarning(CedarFramework::LoggingCategory::Serialization)
-                    << QStringLiteral("Failed to serialize the item's key");
-            return QJsonValue(QJsonValue::Undefined);
-        }
+    const QJsonValue serializedValue = entry.serializer(value);
 
-        // Serialize value
-        const QJsonValue serializedValue = serialize(value.values(key));
+    if (serializedValue.isUndefined())
+    {
+        qCWarning(CedarFramework::LoggingCategory::Serialization)
+                << QStringLiteral("Failed to serialize the value of the type:") << entry.tag;
+        return QJsonValue(QJsonValue::Undefined);
+    }
 
-        if (serializedValue.isUndefined())
-        {
-            qCWarning(CedarFramework::LoggingCategory::Serialization)
-                    << QStringLiteral("Failed to serialize the item's value with key:")
-                    << serializedKey;
-            return QJsonValue(QJsonValue::Undefined);
-        }
+    return QJsonObject {
+        { QStringLiteral("type"), entry.tag },
+        { QStringLiteral("value"), serializedValue }
+    };
+}
 
-        object.insert(serializedKey, serializedValue);
+#ifdef CEDARFRAMEWORK_HAS_STD_VARIANT
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes an alternative of the std::variant value
+ *
+ * \tparam  I   Index of the alternative
+ * \tparam  V   std::variant type
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+template<std::size_t I, typename V>
+QJsonValue serializeVariantAlternative(const V &value)
+{
+    return serialize(std::get<I>(value));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes the std::variant value together with the type tag of the held alternative
+ *
+ * \tparam  V   std::variant type
+ * \tparam  I   Indexes of the alternatives
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+template<typename V, std::size_t... I>
+QJsonValue serializeVariant(const V &value, std::index_sequence<I...>)
+{
+    using AlternativeSerializer = QJsonValue (*)(const V &);
+    static const AlternativeSerializer serializers[] = { &serializeVariantAlternative<I, V>... };
+    static const QString tags[] = { TypeTag<std::variant_alternative_t<I, V>>::name()... };
+
+    if (value.valueless_by_exception())
+    {
+        qCWarning(CedarFramework::LoggingCategory::Serialization)
+                << QStringLiteral("Cannot serialize a valueless std::variant");
+        return QJsonValue(QJsonValue::Undefined);
     }
 
-    return object;
+    const QJsonValue serializedValue = serializers[value.index()](value);
+
+    if (serializedValue.isUndefined())
+    {
+        qCWarning(CedarFramework::LoggingCategory::Serialization)
+                << QStringLiteral("Failed to serialize the std::variant alternative of the type:")
+                << tags[value.index()];
+        return QJsonValue(QJsonValue::Undefined);
+    }
+
+    return QJsonObject {
+        { QStringLiteral("type"), tags[value.index()] },
+        { QStringLiteral("value"), serializedValue }
+    };
+}
+#endif
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+QJsonValue serialize(const std::unique_ptr<T> &value)
+{
+    if (!value)
+    {
+        return QJsonValue::Null;
+    }
+
+    return Internal::serializePolymorphic(*value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+QJsonValue serialize(const std::shared_ptr<T> &value)
+{
+    if (!value)
+    {
+        return QJsonValue::Null;
+    }
+
+    return Internal::serializePolymorphic(*value);
+}
+
+#ifdef CEDARFRAMEWORK_HAS_STD_VARIANT
+// -------------------------------------------------------------------------------------------------
+
+template<typename... T>
+QJsonValue serialize(const std::variant<T...> &value)
+{
+    return Internal::serializeVariant(value, std::index_sequence_for<T...>());
 }
+#endif
 
 // -------------------------------------------------------------------------------------------------
 
@@ -724,4 +1273,68 @@ QString serializeKey(const T &value, bool *ok)
     }
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+QJsonValue serialize(const T &value, const EncodingProfile &profile)
+{
+    const EncodingScope scope(profile);
+    return serialize(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Explicit instantiations
+// -------------------------------------------------------------------------------------------------
+
+// Serialization of the common containers is instantiated in the library so that it isn't
+// instantiated again in each translation unit that uses it
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QList<int> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QList<double> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QList<QString> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QList<QVariant> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QVector<int> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QVector<double> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QVector<QString> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const std::vector<int> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const std::vector<double> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const std::vector<QString> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QMap<QString, int> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QMap<QString, double> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QMap<QString, QString> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QMap<QString, QVariant> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QHash<QString, QString> &);
+
+extern template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QHash<QString, QVariant> &);
+
 } // namespace CedarFramework
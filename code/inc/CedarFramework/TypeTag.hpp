@@ -0,0 +1,230 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the type tags used for serialization and deserialization of std::variant values and
+ * polymorphic types
+ */
+
+#pragma once
+
+// Cedar Framework includes
+#include <CedarFramework/CedarFrameworkExport.hpp>
+#include <CedarFramework/LoggingCategories.hpp>
+
+// Qt includes
+#include <QtCore/QHash>
+#include <QtCore/QJsonValue>
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QString>
+
+// System includes
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+
+#if (__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))
+#include <variant>
+#endif
+
+// Forward declarations
+
+// Macros
+
+#if (__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))
+//! Defined if std::variant is available (C++17)
+#define CEDARFRAMEWORK_HAS_STD_VARIANT
+#endif
+
+/*!
+ * Declares the type tag that is written to the JSON representation of a std::variant alternative or
+ * a polymorphic type
+ *
+ * \param   Type    Type
+ * \param   tag     Type tag (string literal)
+ *
+ * \note    The macro needs to be used in the global namespace
+ */
+#define CEDARFRAMEWORK_TYPE_TAG(Type, tag) \
+    namespace CedarFramework \
+    { \
+    template<> \
+    struct TypeTag<Type> \
+    { \
+        static QString name() \
+        { \
+            return QStringLiteral(tag); \
+        } \
+    }; \
+    }
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+/*!
+ * Type tag of a std::variant alternative or a polymorphic type, declared with the
+ * CEDARFRAMEWORK_TYPE_TAG() macro
+ *
+ * \tparam  T   Type
+ *
+ * The specializations contain:
+ *
+ * - static QString name(): returns the type tag
+ */
+template<typename T>
+struct TypeTag;
+
+namespace Internal
+{
+
+/*!
+ * Registry of the types derived from a polymorphic base type
+ *
+ * \tparam  Base    Base type
+ */
+template<typename Base>
+class PolymorphicTypeRegistry
+{
+public:
+    //! Serialization function for a derived type
+    using Serializer = QJsonValue (*)(const Base &value);
+
+    //! Factory that creates and deserializes a derived type
+    using Factory = bool (*)(const QJsonValue &json, std::unique_ptr<Base> *value);
+
+    //! Registered derived type
+    struct Entry
+    {
+        //! Type tag
+        QString tag;
+
+        //! Serialization function
+        Serializer serializer = nullptr;
+
+        //! Factory
+        Factory factory = nullptr;
+    };
+
+    /*!
+     * Gets the registry of the base type
+     *
+     * \return  Registry
+     */
+    static PolymorphicTypeRegistry &instance()
+    {
+        static PolymorphicTypeRegistry registry;
+        return registry;
+    }
+
+    /*!
+     * Adds a derived type
+     *
+     * \param   type    Type info of the derived type
+     * \param   entry   Registered derived type
+     *
+     * \retval  true    Success
+     * \retval  false   Failure, the type tag is already registered for another derived type
+     *
+     * \note    Adding a derived type again replaces its previous registration including its type
+     *          tag
+     */
+    bool add(const std::type_index &type, const Entry &entry)
+    {
+        QWriteLocker locker(&m_lock);
+        const auto typeIt = m_entriesByType.find(type);
+        const bool registeredType = (typeIt != m_entriesByType.end());
+
+        if (m_entriesByTag.contains(entry.tag) &&
+            ((!registeredType) || (typeIt->second.tag != entry.tag)))
+        {
+            qCWarning(CedarFramework::LoggingCategory::Deserialization)
+                    << QStringLiteral("Type tag is already registered for another type:")
+                    << entry.tag;
+            return false;
+        }
+
+        if (registeredType)
+        {
+            m_entriesByTag.remove(typeIt->second.tag);
+        }
+
+        m_entriesByType[type] = entry;
+        m_entriesByTag.insert(entry.tag, entry);
+        return true;
+    }
+
+    /*!
+     * Finds a derived type by its type info
+     *
+     * \param       type    Type info of the derived type
+     * \param[out]  entry   Output for the registered derived type
+     *
+     * \retval  true    Derived type was found
+     * \retval  false   Derived type was not found
+     */
+    bool find(const std::type_index &type, Entry *entry) const
+    {
+        QReadLocker locker(&m_lock);
+        const auto it = m_entriesByType.find(type);
+
+        if (it == m_entriesByType.end())
+        {
+            return false;
+        }
+
+        *entry = it->second;
+        return true;
+    }
+
+    /*!
+     * Finds a derived type by its type tag
+     *
+     * \param       tag     Type tag
+     * \param[out]  entry   Output for the registered derived type
+     *
+     * \retval  true    Derived type was found
+     * \retval  false   Derived type was not found
+     */
+    bool find(const QString &tag, Entry *entry) const
+    {
+        QReadLocker locker(&m_lock);
+        const auto it = m_entriesByTag.constFind(tag);
+
+        if (it == m_entriesByTag.constEnd())
+        {
+            return false;
+        }
+
+        *entry = it.value();
+        return true;
+    }
+
+private:
+    //! Lock for the registered types
+    mutable QReadWriteLock m_lock;
+
+    //! Registered types by their type info
+    std::unordered_map<std::type_index, Entry> m_entriesByType;
+
+    //! Registered types by their type tags
+    QHash<QString, Entry> m_entriesByTag;
+};
+
+} // namespace Internal
+
+} // namespace CedarFramework
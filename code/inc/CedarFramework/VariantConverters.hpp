@@ -0,0 +1,193 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the registry of the converters used for serialization and deserialization of QVariant
+ * values
+ */
+
+#pragma once
+
+// Cedar Framework includes
+#include <CedarFramework/Deserialization.hpp>
+#include <CedarFramework/Serialization.hpp>
+
+// Qt includes
+#include <QtCore/QVariant>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+//! Serialization function for a QVariant value of a specific type
+using VariantSerializer = QJsonValue (*)(const QVariant &value);
+
+//! Deserialization function for a QVariant value of a specific type
+using VariantDeserializer = bool (*)(const QJsonValue &json, QVariant *value);
+
+/*!
+ * Registers the converter for QVariant values of the specified type
+ *
+ * \param   typeId          Meta-type ID
+ * \param   serializer      Serialization function
+ * \param   deserializer    Deserialization function
+ *
+ * \note    Converters for the built-in types supported by serialize() and deserialize() are
+ *          registered by default. Registering a converter for a type again replaces it.
+ */
+CEDARFRAMEWORK_EXPORT void registerVariantConverter(const int typeId,
+                                                    VariantSerializer serializer,
+                                                    VariantDeserializer deserializer);
+
+/*!
+ * Registers the converter for QVariant values of the specified type that uses the serialize() and
+ * deserialize() functions of the type
+ *
+ * \tparam  T   Value type
+ */
+template<typename T>
+void registerVariantConverter();
+
+/*!
+ * Checks if a converter is registered for QVariant values of the specified type
+ *
+ * \param   typeId  Meta-type ID
+ *
+ * \retval  true    Converter is registered
+ * \retval  false   Converter is not registered
+ */
+CEDARFRAMEWORK_EXPORT bool hasVariantConverter(const int typeId);
+
+/*!
+ * Serializes the QVariant value together with its type so that it can be deserialized to the exact
+ * same type
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value (*JSON Object* with "type" and "value" members or *JSON Null* for an
+ *          invalid QVariant) or QJsonValue::Undefined in case of an error
+ */
+CEDARFRAMEWORK_EXPORT QJsonValue serializeTypedVariant(const QVariant &value);
+
+/*!
+ * Deserializes the QVariant value that was serialized together with its type
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+CEDARFRAMEWORK_EXPORT bool deserializeTypedVariant(const QJsonValue &json, QVariant *value);
+
+namespace Internal
+{
+
+/*!
+ * Gets the registered serialization function for QVariant values of the specified type
+ *
+ * \param   typeId  Meta-type ID
+ *
+ * \return  Serialization function or nullptr if no converter is registered for the type
+ */
+CEDARFRAMEWORK_EXPORT VariantSerializer variantSerializer(const int typeId);
+
+/*!
+ * Gets the registered deserialization function for QVariant values of the specified type
+ *
+ * \param   typeId  Meta-type ID
+ *
+ * \return  Deserialization function or nullptr if no converter is registered for the type
+ */
+CEDARFRAMEWORK_EXPORT VariantDeserializer variantDeserializer(const int typeId);
+
+/*!
+ * Serializes a QVariant value with the serialize() function of the type
+ *
+ * \tparam  T   Value type
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+template<typename T>
+QJsonValue serializeVariantValue(const QVariant &value);
+
+/*!
+ * Deserializes a QVariant value with the deserialize() function of the type
+ *
+ * \tparam  T   Value type
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T>
+bool deserializeVariantValue(const QJsonValue &json, QVariant *value);
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+// Template definitions
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+void registerVariantConverter()
+{
+    registerVariantConverter(qMetaTypeId<T>(),
+                             &Internal::serializeVariantValue<T>,
+                             &Internal::deserializeVariantValue<T>);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+template<typename T>
+QJsonValue serializeVariantValue(const QVariant &value)
+{
+    return serialize(value.value<T>());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserializeVariantValue(const QJsonValue &json, QVariant *value)
+{
+    T deserializedValue;
+
+    if (!deserialize(json, &deserializedValue))
+    {
+        return false;
+    }
+
+    *value = QVariant::fromValue(deserializedValue);
+    return true;
+}
+
+} // namespace Internal
+
+} // namespace CedarFramework
@@ -0,0 +1,450 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a base64 codec that works directly on the UTF-16 storage of a string
+ */
+
+// Own header
+#include "Base64.hpp"
+
+// Cedar Framework includes
+#include <CedarFramework/Encoding.hpp>
+
+// Qt includes
+
+// System includes
+#include <cstring>
+
+// Forward declarations
+
+// Macros
+
+// The SSSE3 codec is used directly if the target always supports it, otherwise it is compiled for
+// SSSE3 per function and selected at runtime if the CPU supports it
+#if defined(__SSSE3__) || defined(__AVX__)
+#define CEDARFRAMEWORK_BASE64_SSSE3
+#define CEDARFRAMEWORK_BASE64_SSSE3_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CEDARFRAMEWORK_BASE64_SSSE3
+#define CEDARFRAMEWORK_BASE64_SSSE3_DISPATCH
+#define CEDARFRAMEWORK_BASE64_SSSE3_TARGET __attribute__((target("ssse3")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define CEDARFRAMEWORK_BASE64_SSSE3
+#define CEDARFRAMEWORK_BASE64_SSSE3_DISPATCH
+#define CEDARFRAMEWORK_BASE64_SSSE3_TARGET
+#endif
+
+#ifdef CEDARFRAMEWORK_BASE64_SSSE3
+#include <tmmintrin.h>
+#endif
+
+#if defined(CEDARFRAMEWORK_BASE64_SSSE3_DISPATCH) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+//! Base64 alphabet
+constexpr char base64Alphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+//! Value of a character that is not part of the base64 alphabet
+constexpr quint8 invalidBase64Value = 0xFF;
+
+//! Lookup table with the values of the Latin-1 characters in base64 encoding
+struct Base64DecodingTable
+{
+    //! Constructor
+    constexpr Base64DecodingTable()
+        : values()
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            values[i] = invalidBase64Value;
+        }
+
+        for (int i = 0; i < 64; i++)
+        {
+            values[static_cast<quint8>(base64Alphabet[i])] = static_cast<quint8>(i);
+        }
+    }
+
+    //! Values of the characters
+    quint8 values[256];
+};
+
+//! Values of the Latin-1 characters in base64 encoding
+constexpr Base64DecodingTable base64DecodingTable;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the value of a character in base64 encoding
+ *
+ * \param   character   Character
+ *
+ * \return  Value in range [0, 63] or invalidBase64Value if the character is not part of the base64
+ *          alphabet
+ */
+inline quint32 base64Value(const ushort character)
+{
+    return (character < 256u) ? base64DecodingTable.values[character] : invalidBase64Value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+#ifdef CEDARFRAMEWORK_BASE64_SSSE3
+/*!
+ * Checks if the SSSE3 codec can be used
+ *
+ * \retval  true    SSSE3 codec can be used
+ * \retval  false   Only the scalar codec can be used
+ */
+bool isSsse3CodecEnabled()
+{
+#ifdef CEDARFRAMEWORK_BASE64_SSSE3_DISPATCH
+    static const bool supported = []()
+    {
+#ifdef _MSC_VER
+        int info[4] = {};
+        __cpuid(info, 1);
+        return (info[2] & (1 << 9)) != 0;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("ssse3") != 0;
+#endif
+    }();
+
+    return supported && isSimdEnabled();
+#else
+    return isSimdEnabled();
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Encodes a block of 12 bytes into 16 characters
+ *
+ * \param   input   Input buffer, 16 bytes are read from it (only the first 12 are encoded)
+ * \param   output  Output buffer for the 16 characters
+ */
+CEDARFRAMEWORK_BASE64_SSSE3_TARGET inline void encodeBase64Block(const quint8 *input,
+                                                                  ushort *output)
+{
+    // Split each group of 3 bytes into 4 indexes of 6 bits, one index per byte
+    const __m128i bytes = _mm_shuffle_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(input)),
+                _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+    const __m128i high = _mm_mulhi_epu16(_mm_and_si128(bytes, _mm_set1_epi32(0x0FC0FC00)),
+                                         _mm_set1_epi32(0x04000040));
+    const __m128i low = _mm_mullo_epi16(_mm_and_si128(bytes, _mm_set1_epi32(0x003F03F0)),
+                                        _mm_set1_epi32(0x01000010));
+    const __m128i indexes = _mm_or_si128(high, low);
+
+    // Map the indexes to the alphabet by adding an offset that depends on their range: [0, 25],
+    // [26, 51], [52, 61], 62 or 63
+    __m128i range = _mm_subs_epu8(indexes, _mm_set1_epi8(51));
+    range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indexes),
+                                              _mm_set1_epi8(13)));
+
+    const __m128i offsets = _mm_shuffle_epi8(
+                _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                              '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                              '/' - 63, 'A', 0, 0),
+                range);
+    const __m128i characters = _mm_add_epi8(indexes, offsets);
+
+    // Widen the characters to UTF-16
+    const __m128i zero = _mm_setzero_si128();
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_unpacklo_epi8(characters, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 8), _mm_unpackhi_epi8(characters, zero));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Decodes a block of 16 characters into 12 bytes
+ *
+ * \param   input   Input buffer with the 16 characters
+ * \param   output  Output buffer for the 12 bytes
+ *
+ * \retval  true    Success
+ * \retval  false   Failure, a character is not part of the base64 alphabet
+ */
+CEDARFRAMEWORK_BASE64_SSSE3_TARGET inline bool decodeBase64Block(const ushort *input,
+                                                                  quint8 *output)
+{
+    // Narrow the characters to Latin-1, the characters outside of it are saturated either to 0x00
+    // or to 0xFF and they are both rejected below
+    const __m128i characters = _mm_packus_epi16(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(input)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + 8)));
+
+    // Validate the characters: the low nibble selects the set of the high nibbles that are valid
+    // for it and the high nibble selects its bit in that set
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(characters, 4), nibbleMask);
+    const __m128i lowNibbles = _mm_and_si128(characters, nibbleMask);
+
+    const __m128i validHighNibbles = _mm_shuffle_epi8(
+                _mm_setr_epi8(static_cast<char>(0xA8), static_cast<char>(0xF8),
+                              static_cast<char>(0xF8), static_cast<char>(0xF8),
+                              static_cast<char>(0xF8), static_cast<char>(0xF8),
+                              static_cast<char>(0xF8), static_cast<char>(0xF8),
+                              static_cast<char>(0xF8), static_cast<char>(0xF8),
+                              static_cast<char>(0xF0), 0x54, 0x50, 0x50, 0x50, 0x54),
+                lowNibbles);
+    const __m128i highNibbleBits = _mm_shuffle_epi8(
+                _mm_setr_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, static_cast<char>(0x80),
+                              0, 0, 0, 0, 0, 0, 0, 0),
+                highNibbles);
+    const __m128i invalid = _mm_cmpeq_epi8(_mm_and_si128(validHighNibbles, highNibbleBits),
+                                           _mm_setzero_si128());
+
+    if (_mm_movemask_epi8(invalid) != 0)
+    {
+        return false;
+    }
+
+    // Map the characters to their values by adding an offset that depends on the high nibble,
+    // except for "/" which shares its high nibble with "+"
+    const __m128i slash = _mm_cmpeq_epi8(characters, _mm_set1_epi8('/'));
+    const __m128i offsets = _mm_add_epi8(
+                _mm_shuffle_epi8(_mm_setr_epi8(0, 0, 62 - '+', 52 - '0', -'A', -'A', 26 - 'a',
+                                               26 - 'a', 0, 0, 0, 0, 0, 0, 0, 0),
+                                 highNibbles),
+                _mm_and_si128(slash, _mm_set1_epi8(('+' - '/') + (63 - 62))));
+    const __m128i values = _mm_add_epi8(characters, offsets);
+
+    // Merge each group of 4 values of 6 bits into 3 bytes
+    const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    const __m128i bytes = _mm_shuffle_epi8(
+                groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(output), bytes);
+    const qint32 lastBytes = _mm_cvtsi128_si32(_mm_srli_si128(bytes, 8));
+    memcpy(output + 8, &lastBytes, sizeof(lastBytes));
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Encodes the blocks of 12 bytes with the SSSE3 codec
+ *
+ * \param   input   Input buffer
+ * \param   size    Size of the input buffer
+ * \param   output  Output buffer
+ *
+ * \return  Number of encoded bytes
+ */
+CEDARFRAMEWORK_BASE64_SSSE3_TARGET int encodeBase64Blocks(const quint8 *input,
+                                                          const int size,
+                                                          ushort *output)
+{
+    int position = 0;
+
+    // Each block reads 16 bytes, so the block loop stops while at least 4 more bytes are available
+    for (; (size - position) >= 16; position += 12)
+    {
+        encodeBase64Block(input + position, output);
+        output += 16;
+    }
+
+    return position;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Decodes the blocks of 16 characters with the SSSE3 codec
+ *
+ * \param   input   Input buffer
+ * \param   size    Size of the input buffer
+ * \param   output  Output buffer
+ *
+ * \return  Number of decoded characters or -1 in case of an invalid character
+ */
+CEDARFRAMEWORK_BASE64_SSSE3_TARGET int decodeBase64Blocks(const ushort *input,
+                                                          const int size,
+                                                          quint8 *output)
+{
+    int position = 0;
+
+    for (; (size - position) >= 16; position += 16)
+    {
+        if (!decodeBase64Block(input + position, output))
+        {
+            return -1;
+        }
+
+        output += 12;
+    }
+
+    return position;
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+QString encodeBase64(const QByteArray &data)
+{
+    const int size = data.size();
+    QString result(((size + 2) / 3) * 4, Qt::Uninitialized);
+
+    const auto *input = reinterpret_cast<const quint8 *>(data.constData());
+    auto *output = reinterpret_cast<ushort *>(result.data());
+    int position = 0;
+
+#ifdef CEDARFRAMEWORK_BASE64_SSSE3
+    if (isSsse3CodecEnabled())
+    {
+        position = encodeBase64Blocks(input, size, output);
+        output += (position / 3) * 4;
+    }
+#endif
+
+    for (; (size - position) >= 3; position += 3)
+    {
+        const quint32 group = (static_cast<quint32>(input[position]) << 16) |
+                              (static_cast<quint32>(input[position + 1]) << 8) |
+                              static_cast<quint32>(input[position + 2]);
+
+        output[0] = static_cast<ushort>(base64Alphabet[(group >> 18) & 0x3F]);
+        output[1] = static_cast<ushort>(base64Alphabet[(group >> 12) & 0x3F]);
+        output[2] = static_cast<ushort>(base64Alphabet[(group >> 6) & 0x3F]);
+        output[3] = static_cast<ushort>(base64Alphabet[group & 0x3F]);
+        output += 4;
+    }
+
+    if (position < size)
+    {
+        quint32 group = static_cast<quint32>(input[position]) << 16;
+
+        if ((size - position) == 2)
+        {
+            group |= static_cast<quint32>(input[position + 1]) << 8;
+        }
+
+        output[0] = static_cast<ushort>(base64Alphabet[(group >> 18) & 0x3F]);
+        output[1] = static_cast<ushort>(base64Alphabet[(group >> 12) & 0x3F]);
+        output[2] = static_cast<ushort>(((size - position) == 2)
+                                        ? base64Alphabet[(group >> 6) & 0x3F]
+                                        : '=');
+        output[3] = static_cast<ushort>('=');
+    }
+
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool decodeBase64(const QString &input, QByteArray *output)
+{
+    Q_ASSERT(output != nullptr);
+
+    const auto *characters = input.utf16();
+    int size = input.size();
+
+    // Strip the padding
+    if ((size % 4) == 0)
+    {
+        for (int i = 0; (i < 2) && (size > 0) && (characters[size - 1] == '='); i++)
+        {
+            size--;
+        }
+    }
+
+    const int remainder = size % 4;
+
+    if (remainder == 1)
+    {
+        return false;
+    }
+
+    output->resize(((size / 4) * 3) + ((remainder * 3) / 4));
+    auto *bytes = reinterpret_cast<quint8 *>(output->data());
+    int position = 0;
+
+#ifdef CEDARFRAMEWORK_BASE64_SSSE3
+    if (isSsse3CodecEnabled())
+    {
+        position = decodeBase64Blocks(characters, size, bytes);
+
+        if (position < 0)
+        {
+            return false;
+        }
+
+        bytes += (position / 4) * 3;
+    }
+#endif
+
+    for (; (size - position) >= 4; position += 4)
+    {
+        const quint32 value0 = base64Value(characters[position]);
+        const quint32 value1 = base64Value(characters[position + 1]);
+        const quint32 value2 = base64Value(characters[position + 2]);
+        const quint32 value3 = base64Value(characters[position + 3]);
+
+        if ((value0 | value1 | value2 | value3) > 63u)
+        {
+            return false;
+        }
+
+        const quint32 group = (value0 << 18) | (value1 << 12) | (value2 << 6) | value3;
+        bytes[0] = static_cast<quint8>(group >> 16);
+        bytes[1] = static_cast<quint8>(group >> 8);
+        bytes[2] = static_cast<quint8>(group);
+        bytes += 3;
+    }
+
+    if (remainder != 0)
+    {
+        const quint32 value0 = base64Value(characters[position]);
+        const quint32 value1 = base64Value(characters[position + 1]);
+        const quint32 value2 = (remainder == 3) ? base64Value(characters[position + 2]) : 0u;
+
+        if ((value0 | value1 | value2) > 63u)
+        {
+            return false;
+        }
+
+        const quint32 group = (value0 << 18) | (value1 << 12) | (value2 << 6);
+        bytes[0] = static_cast<quint8>(group >> 16);
+
+        if (remainder == 3)
+        {
+            bytes[1] = static_cast<quint8>(group >> 8);
+        }
+    }
+
+    return true;
+}
+
+} // namespace Internal
+
+} // namespace CedarFramework
@@ -0,0 +1,75 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a base64 codec that works directly on the UTF-16 storage of a string
+ *
+ * The codec uses the standard base64 alphabet ("A-Z", "a-z", "0-9", "+" and "/"). On x86 blocks of
+ * 16 characters are encoded and decoded with SSSE3 instructions if the CPU supports them (checked
+ * at runtime unless the target always supports SSSE3), otherwise a table based scalar codec is
+ * used. Both produce identical results.
+ */
+
+#pragma once
+
+// Cedar Framework includes
+
+// Qt includes
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+/*!
+ * Encodes the data in base64 encoding with padding
+ *
+ * \param   data    Data
+ *
+ * \return  Same string as QString::fromLatin1(data.toBase64())
+ */
+QString encodeBase64(const QByteArray &data);
+
+/*!
+ * Decodes the data from a string in base64 encoding
+ *
+ * \param   input   String in base64 encoding
+ * \param   output  Output for the data
+ *
+ * \retval  true    Success
+ * \retval  false   Failure, the string contains a character that is not part of the base64
+ *                  alphabet or its size is not valid
+ *
+ * \note    The padding is optional, but if it is present the size of the string has to be a
+ *          multiple of 4
+ * \note    The content of the output is unspecified in case of a failure
+ */
+bool decodeBase64(const QString &input, QByteArray *output);
+
+} // namespace Internal
+
+} // namespace CedarFramework
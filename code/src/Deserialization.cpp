@@ -22,6 +22,13 @@
 #include <CedarFramework/Deserialization.hpp>
 
 // Cedar Framework includes
+#include <CedarFramework/Interning.hpp>
+#include <CedarFramework/MetaObject.hpp>
+#include <CedarFramework/RegularExpressionCache.hpp>
+#include <CedarFramework/VariantConverters.hpp>
+#include "Base64.hpp"
+#include "IsoDateTime.hpp"
+#include "Transcoding.hpp"
 
 // Qt includes
 #include <QtCore/QBitArray>
@@ -45,6 +52,7 @@
 
 // System includes
 #include <cmath>
+#include <limits>
 
 // Forward declarations
 
@@ -78,7 +86,7 @@ bool convertIntegerValue(const qint64 inputValue, T_OUT *outputValue)
 
     if ((inputValue < lowwerLimit) || (inputValue > upperLimit))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::OutOfRange)
                 << QString("Value [%1] is out of range for the its data type "
                            "(min: [%2], max: [%3])!")
                    .arg(inputValue)
@@ -104,7 +112,7 @@ bool convertIntegerValue(const qint64 inputValue, T_OUT *outputValue)
     {
         if (inputValue < 0LL)
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::OutOfRange)
                     << QString("Value [%1] is out of range for the its data type "
                                "(min: [%2], max: [%3])!")
                        .arg(inputValue)
@@ -131,7 +139,7 @@ bool convertIntegerValue(const quint64 inputValue, T_OUT *outputValue)
     {
         if (inputValue > static_cast<quint64>(upperLimit))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::OutOfRange)
                     << QString("Value [%1] is out of range for the its data type "
                                "(min: [%2], max: [%3])!")
                        .arg(inputValue)
@@ -157,7 +165,7 @@ bool convertIntegerValue(const double inputValue, T_OUT *outputValue)
     if ((inputValue < lowwerLimit) ||
         (inputValue > upperLimit))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::OutOfRange)
                 << QString("Value [%1] is out of range for the its data type "
                            "(min: [%2], max: [%3])!")
                    .arg(inputValue, 0, 'f')
@@ -172,10 +180,196 @@ bool convertIntegerValue(const double inputValue, T_OUT *outputValue)
 
 // -------------------------------------------------------------------------------------------------
 
+//! Format of a number stored in a string
+enum class NumberFormat
+{
+    //! Decimal integer that fits in 64 bits (optional minus sign followed by digits only)
+    Integer,
+
+    //! Number that can only be parsed as a floating-point value
+    FloatingPoint,
+
+    //! Any other input (for example with whitespace, a plus sign or other characters)
+    Unknown
+};
+
+//! Result of scanning a number stored in a string
+struct ScannedNumber
+{
+    //! Format of the number
+    NumberFormat format = NumberFormat::Unknown;
+
+    //! Sign of the integer
+    bool negative = false;
+
+    //! Absolute value of the integer
+    quint64 magnitude = 0ULL;
+
+    /*!
+     * Checks if the integer can be stored in a signed 64-bit integer
+     *
+     * \retval  true    Integer fits in a signed 64-bit integer
+     * \retval  false   Integer doesn't fit in a signed 64-bit integer or the number is not an
+     *                  integer
+     */
+    bool isSignedInteger() const
+    {
+        constexpr auto signedLimit = static_cast<quint64>(std::numeric_limits<qint64>::max());
+
+        if (format != NumberFormat::Integer)
+        {
+            return false;
+        }
+
+        return negative ? (magnitude <= (signedLimit + 1ULL))
+                        : (magnitude <= signedLimit);
+    }
+
+    /*!
+     * Gets the integer as a signed 64-bit integer
+     *
+     * \return  Integer value
+     *
+     * \note    Only valid if isSignedInteger() returns true!
+     */
+    qint64 toSignedInteger() const
+    {
+        if (!negative)
+        {
+            return static_cast<qint64>(magnitude);
+        }
+
+        if (magnitude == 0ULL)
+        {
+            return 0LL;
+        }
+
+        // Negate through (magnitude - 1) so that the lowest value doesn't overflow
+        return -static_cast<qint64>(magnitude - 1ULL) - 1LL;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Classifies a number stored in a string in a single pass over its UTF-16 characters
+ *
+ * \param   inputValue  Input value
+ *
+ * \return  Scan result. For an integer it also holds its sign and absolute value.
+ *
+ * \note    An input is classified as a floating-point number only if it consists of characters
+ *          of a number and contains at least one of '.', 'e' or 'E', or if it is an integer that
+ *          doesn't fit in 64 bits. Integer parsing always fails for such input.
+ */
+ScannedNumber scanNumber(const QString &inputValue)
+{
+    ScannedNumber result;
+
+    const QChar *it = inputValue.constData();
+    const QChar *const end = it + inputValue.size();
+
+    if ((it != end) && (it->unicode() == '-'))
+    {
+        result.negative = true;
+        it++;
+    }
+
+    // Accumulate the integer digits
+    constexpr quint64 maxValue = std::numeric_limits<quint64>::max();
+    const QChar *const digitsBegin = it;
+    bool overflow = false;
+
+    for (; it != end; it++)
+    {
+        const ushort character = it->unicode();
+
+        if ((character < '0') || (character > '9'))
+        {
+            break;
+        }
+
+        const quint64 digit = static_cast<quint64>(character - '0');
+
+        if (result.magnitude > ((maxValue - digit) / 10ULL))
+        {
+            overflow = true;
+        }
+        else
+        {
+            result.magnitude = (result.magnitude * 10ULL) + digit;
+        }
+    }
+
+    if ((it == end) && (it != digitsBegin))
+    {
+        result.format = overflow ? NumberFormat::FloatingPoint
+                                 : NumberFormat::Integer;
+        return result;
+    }
+
+    // Check the rest of the input for the characters of a floating-point number
+    bool floatingPoint = false;
+
+    for (; it != end; it++)
+    {
+        switch (it->unicode())
+        {
+            case '.':
+            case 'e':
+            case 'E':
+            {
+                floatingPoint = true;
+                break;
+            }
+
+            case '+':
+            case '-':
+            case '0':
+            case '1':
+            case '2':
+            case '3':
+            case '4':
+            case '5':
+            case '6':
+            case '7':
+            case '8':
+            case '9':
+            {
+                break;
+            }
+
+            default:
+            {
+                return result;
+            }
+        }
+    }
+
+    if (floatingPoint)
+    {
+        result.format = NumberFormat::FloatingPoint;
+    }
+
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename T_OUT, IsMax32BitInteger<T_OUT> = true>
 bool convertIntegerValue(const QString &inputValue, T_OUT *outputValue)
 {
+    const ScannedNumber number = scanNumber(inputValue);
+
     // Through a signed integer
+    if (number.format == NumberFormat::Integer)
+    {
+        if (number.isSignedInteger())
+        {
+            return convertIntegerValue(number.toSignedInteger(), outputValue);
+        }
+    }
+    else if (number.format == NumberFormat::Unknown)
     {
         bool ok = false;
         const qint64 integerValue = inputValue.toLongLong(&ok);
@@ -197,7 +391,7 @@ bool convertIntegerValue(const QString &inputValue, T_OUT *outputValue)
         }
     }
 
-    qCWarning(CedarFramework::LoggingCategory::Deserialization)
+    CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
             << QString("Value [%1] is not a valid integer!").arg(inputValue);
     return false;
 }
@@ -207,7 +401,17 @@ bool convertIntegerValue(const QString &inputValue, T_OUT *outputValue)
 template<typename T_OUT, Is64BitInteger<T_OUT> = true>
 bool convertIntegerValue(const QString &inputValue, T_OUT *outputValue)
 {
+    const ScannedNumber number = scanNumber(inputValue);
+
     // Through a signed integer
+    if (number.format == NumberFormat::Integer)
+    {
+        if (number.isSignedInteger())
+        {
+            return convertIntegerValue(number.toSignedInteger(), outputValue);
+        }
+    }
+    else if (number.format == NumberFormat::Unknown)
     {
         bool ok = false;
         const qint64 integerValue = inputValue.toLongLong(&ok);
@@ -219,6 +423,14 @@ bool convertIntegerValue(const QString &inputValue, T_OUT *outputValue)
     }
 
     // Through an unsigned integer
+    if (number.format == NumberFormat::Integer)
+    {
+        if (!number.negative)
+        {
+            return convertIntegerValue(number.magnitude, outputValue);
+        }
+    }
+    else if (number.format == NumberFormat::Unknown)
     {
         bool ok = false;
         const quint64 integerValue = inputValue.toULongLong(&ok);
@@ -240,7 +452,7 @@ bool convertIntegerValue(const QString &inputValue, T_OUT *outputValue)
         }
     }
 
-    qCWarning(CedarFramework::LoggingCategory::Deserialization)
+    CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
             << QString("Value [%1] is not a valid integer!").arg(inputValue);
     return false;
 }
@@ -260,13 +472,33 @@ bool deserializeIntegerValue(const QJsonValue inputValue, T_OUT *outputValue)
         return convertIntegerValue(inputValue.toString(), outputValue);
     }
 
-    qCWarning(CedarFramework::LoggingCategory::Deserialization)
+    CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
             << QStringLiteral("JSON value is not a valid integer:") << inputValue;
     return false;
 }
 
 // -------------------------------------------------------------------------------------------------
 
+bool parseFloatingPointValue(const QString &inputValue, double *outputValue)
+{
+    constexpr quint64 exactLimit = 9007199254740992ULL;
+    const ScannedNumber number = scanNumber(inputValue);
+
+    // Integers up to 2^53 can be converted exactly without the floating-point parser
+    if ((number.format == NumberFormat::Integer) && (number.magnitude <= exactLimit))
+    {
+        const auto magnitude = static_cast<double>(number.magnitude);
+        *outputValue = number.negative ? -magnitude : magnitude;
+        return true;
+    }
+
+    bool ok = false;
+    *outputValue = inputValue.toDouble(&ok);
+    return ok;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 bool convertFloatingPointValue(const double inputValue, float *outputValue)
 {
     constexpr auto lowwerLimit = -std::numeric_limits<float>::max();
@@ -276,7 +508,7 @@ bool convertFloatingPointValue(const double inputValue, float *outputValue)
     if ((inputValue < static_cast<double>(lowwerLimit)) ||
         (inputValue > static_cast<double>(upperLimit)))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::OutOfRange)
                 << QString("Parameter value [%1] is out of range for the its data type "
                            "(min: [%2], max: [%3])!")
                    .arg(inputValue, 0, 'f')
@@ -289,6 +521,281 @@ bool convertFloatingPointValue(const double inputValue, float *outputValue)
     return true;
 }
 
+// -------------------------------------------------------------------------------------------------
+
+bool convertUuidValue(const QString &inputValue, QUuid *outputValue)
+{
+    *outputValue = QUuid(inputValue);
+
+    if (outputValue->isNull() &&
+        (inputValue != QStringLiteral("{00000000-0000-0000-0000-000000000000}")))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
+                << QString("The value [%1] doesn't represent an UUID value")
+                   .arg(inputValue);
+        return false;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+//! Size of an UUID in compact encoding (16 bytes in base64 encoding without padding)
+constexpr int compactUuidSize = 22;
+
+// -------------------------------------------------------------------------------------------------
+
+bool convertCompactUuidValue(const QString &inputValue, QUuid *outputValue)
+{
+    QByteArray bytes;
+
+    if ((!Internal::decodeBase64(inputValue, &bytes)) || (bytes.size() != 16))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
+                << QString("The value [%1] doesn't represent an UUID value in compact encoding")
+                   .arg(inputValue);
+        return false;
+    }
+
+    *outputValue = QUuid::fromRfc4122(bytes);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool convertJulianDayValue(const QJsonValue &inputValue, QDate *outputValue)
+{
+    qint64 julianDay = 0;
+
+    if (!deserializeIntegerValue(inputValue, &julianDay))
+    {
+        return false;
+    }
+
+    *outputValue = QDate::fromJulianDay(julianDay);
+
+    if (!outputValue->isValid())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
+                << QString("The value [%1] doesn't represent a Julian day").arg(julianDay);
+        return false;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool convertTimeValue(const QJsonValue &inputValue, QTime *outputValue)
+{
+    constexpr int msecsPerDay = 24 * 60 * 60 * 1000;
+    int msecsSinceStartOfDay = 0;
+
+    if (!deserializeIntegerValue(inputValue, &msecsSinceStartOfDay))
+    {
+        return false;
+    }
+
+    if ((msecsSinceStartOfDay < 0) || (msecsSinceStartOfDay >= msecsPerDay))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
+                << QString("The value [%1] doesn't represent milliseconds since midnight")
+                   .arg(msecsSinceStartOfDay);
+        return false;
+    }
+
+    *outputValue = QTime::fromMSecsSinceStartOfDay(msecsSinceStartOfDay);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool convertDateTimeValue(const QJsonValue &inputValue, QDateTime *outputValue)
+{
+    qint64 msecsSinceEpoch = 0;
+
+    if (inputValue.isArray())
+    {
+        // Milliseconds since epoch and offset from UTC
+        const QJsonArray array = inputValue.toArray();
+        int offsetFromUtc = 0;
+
+        if (array.size() != 2)
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
+                    << QString("Date and time in compact encoding must have exactly two items, "
+                               "actual size is [%1]").arg(array.size());
+            return false;
+        }
+
+        if ((!deserializeIntegerValue(array.at(0), &msecsSinceEpoch)) ||
+            (!deserializeIntegerValue(array.at(1), &offsetFromUtc)))
+        {
+            return false;
+        }
+
+        *outputValue = QDateTime::fromMSecsSinceEpoch(msecsSinceEpoch,
+                                                      Qt::OffsetFromUTC,
+                                                      offsetFromUtc);
+    }
+    else
+    {
+        // Milliseconds since epoch in local time
+        if (!deserializeIntegerValue(inputValue, &msecsSinceEpoch))
+        {
+            return false;
+        }
+
+        *outputValue = QDateTime::fromMSecsSinceEpoch(msecsSinceEpoch);
+    }
+
+    if (!outputValue->isValid())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
+                << QStringLiteral("JSON value doesn't represent a date and time value in compact "
+                                  "encoding:")
+                << inputValue;
+        return false;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes the members of a value from a JSON Array in the order they are stored in
+ *
+ * \tparam  T   Member type
+ * \tparam  N   Number of members
+ *
+ * \param   inputValue  JSON Array with the members
+ * \param   typeName    Name of the value type (used in the warnings)
+ *
+ * \param[out]  members     Output for the deserialized members
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T, int N>
+bool deserializePositional(const QJsonArray &inputValue, const char *typeName, T (&members)[N])
+{
+    if (inputValue.size() != N)
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
+                << QString("A %1 needs to have exactly %2 items but this one has %3! JSON value:")
+                   .arg(QLatin1String(typeName))
+                   .arg(N)
+                   .arg(inputValue.size())
+                << inputValue;
+        return false;
+    }
+
+    for (int i = 0; i < N; i++)
+    {
+        if (!deserialize(inputValue.at(i), &members[i]))
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, i)
+                    << QString("Failed to deserialize the item at index %1 of a %2:")
+                       .arg(i)
+                       .arg(QLatin1String(typeName))
+                    << inputValue;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::size_t encodeUtf8(const QString &value, char *output)
+{
+    if (output == nullptr)
+    {
+        return utf8Size(value.constData(), value.size());
+    }
+
+    return utf16ToUtf8(value.constData(), value.size(), output);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool parseTaggedValue(const QJsonValue &json, QString *tag, QJsonValue *value)
+{
+    Q_ASSERT(tag != nullptr);
+    Q_ASSERT(value != nullptr);
+
+    if (!json.isObject())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << "A tagged value needs to be a JSON Object! JSON value:" << json;
+        return false;
+    }
+
+    const QJsonObject jsonObject = json.toObject();
+
+    if (jsonObject.size() != 2)
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
+                << QString("A tagged value needs to have exactly 2 members but this one has %1! "
+                           "JSON value:").arg(jsonObject.size())
+                << json;
+        return false;
+    }
+
+    const auto typeIt = jsonObject.constFind(QStringLiteral("type"));
+    const auto valueIt = jsonObject.constFind(QStringLiteral("value"));
+
+    if ((typeIt == jsonObject.constEnd()) || (valueIt == jsonObject.constEnd()))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::NodeNotFound)
+                << "A tagged value needs to have the \"type\" and \"value\" members! JSON value:"
+                << json;
+        return false;
+    }
+
+    if ((!typeIt.value().isString()) || typeIt.value().toString().isEmpty())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("type"))
+                << "The type tag needs to be a non-empty JSON String! JSON value:" << json;
+        return false;
+    }
+
+    *tag = typeIt.value().toString();
+    *value = valueIt.value();
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+//! Flag if the storage of the deserialized values is reused in the current thread
+thread_local bool storageReuseEnabled = false;
+
+// -------------------------------------------------------------------------------------------------
+
+bool isStorageReuseEnabled()
+{
+    return storageReuseEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+StorageReuseScope::StorageReuseScope()
+    : m_previousState(storageReuseEnabled)
+{
+    storageReuseEnabled = true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+StorageReuseScope::~StorageReuseScope()
+{
+    storageReuseEnabled = m_previousState;
+}
+
 } // namespace Internal
 
 // -------------------------------------------------------------------------------------------------
@@ -336,7 +843,7 @@ bool deserialize(const QJsonValue &json, bool *value)
             return true;
         }
 
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
                 << QString("Not a valid Boolean value in string format [%1]! "
                            "Only [false], [true], [0], and [1] values are allowed!")
                    .arg(stringValue);
@@ -363,14 +870,14 @@ bool deserialize(const QJsonValue &json, bool *value)
             return true;
         }
 
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
                 << QString("Not a valid Boolean value in floating-point format [%1]! "
                            "Only [0.0] and [1.0] values (with 1e-3 rounding error) are allowed!")
                    .arg(doubleValue);
         return false;
     }
 
-    qCWarning(CedarFramework::LoggingCategory::Deserialization)
+    CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
             << QStringLiteral("JSON value is not a valid Boolean value:") << json;
     return false;
 }
@@ -489,12 +996,11 @@ bool deserialize(const QJsonValue &json, float *value)
 
     if (json.isString())
     {
-        bool ok = false;
-        const double doubleValue = json.toString().toDouble(&ok);
+        double doubleValue = 0.0;
 
-        if (!ok)
+        if (!Internal::parseFloatingPointValue(json.toString(), &doubleValue))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
                     << QString("Value [%1] is not a valid floating-point number!")
                        .arg(json.toString());
             return false;
@@ -503,7 +1009,7 @@ bool deserialize(const QJsonValue &json, float *value)
         return Internal::convertFloatingPointValue(doubleValue, value);
     }
 
-    qCWarning(CedarFramework::LoggingCategory::Deserialization)
+    CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
             << QStringLiteral("JSON value is not a valid floating-point number:") << json;
     return false;
 }
@@ -523,12 +1029,9 @@ bool deserialize(const QJsonValue &json, double *value)
 
     if (json.isString())
     {
-        bool ok = false;
-        *value = json.toString().toDouble(&ok);
-
-        if (!ok)
+        if (!Internal::parseFloatingPointValue(json.toString(), value))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
                     << QString("Value [%1] is not a valid floating-point number!")
                        .arg(json.toString());
             return false;
@@ -537,7 +1040,7 @@ bool deserialize(const QJsonValue &json, double *value)
         return true;
     }
 
-    qCWarning(CedarFramework::LoggingCategory::Deserialization)
+    CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
             << QStringLiteral("JSON value is not a valid floating-point number:") << json;
     return false;
 }
@@ -551,7 +1054,7 @@ bool deserialize(const QJsonValue &json, QChar *value)
 
     if (!json.isString())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid character:") << json;
         return false;
     }
@@ -560,7 +1063,7 @@ bool deserialize(const QJsonValue &json, QChar *value)
 
     if (stringValue.size() != 1)
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
                 << QStringLiteral("JSON value contains more than one character:") << stringValue;
         return false;
     }
@@ -578,12 +1081,13 @@ bool deserialize(const QJsonValue &json, QString *value)
 
     if (!json.isString())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a string:") << json;
         return false;
     }
 
-    *value = json.toString();
+    InterningPool *pool = activeInterningPool();
+    *value = (pool != nullptr) ? pool->string(json.toString()) : json.toString();
     return true;
 }
 
@@ -596,28 +1100,16 @@ bool deserialize(const QJsonValue &json, QByteArray *value)
 
     if (!json.isString())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid byte array:") << json;
         return false;
     }
 
-    const auto encodedData = json.toString().toLatin1();
-
-    if (encodedData.isEmpty())
+    if (!Internal::decodeBase64(json.toString(), value))
     {
         value->clear();
-        return true;
-    }
-
-#if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
-    *value = QByteArray::fromBase64(encodedData, QByteArray::AbortOnBase64DecodingErrors);
-#else
-    *value = QByteArray::fromBase64(encodedData);
-#endif
 
-    if (value->isEmpty())
-    {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid byte array:") << json;
         return false;
     }
@@ -635,7 +1127,7 @@ bool deserialize(const QJsonValue &json, QBitArray *value)
     // Get the JSON Array representation
     if (!json.isArray())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid bit array:") << json;
         return false;
     }
@@ -647,7 +1139,7 @@ bool deserialize(const QJsonValue &json, QBitArray *value)
 
     if (!deserialize(jsonArray, &bits))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid bit array:") << json;
         return false;
     }
@@ -676,7 +1168,7 @@ bool deserialize(const QJsonValue &json, QBitArray *value)
 
             default:
             {
-                qCWarning(CedarFramework::LoggingCategory::Deserialization)
+                CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                         << QStringLiteral("JSON value is not a valid bit array:") << json;
                 return false;
             }
@@ -694,14 +1186,20 @@ template<>
 bool deserialize(const QJsonValue &json, std::string *value)
 {
     Q_ASSERT(value != nullptr);
-    QString stringValue;
 
-    if (!deserialize(json, &stringValue))
+    if (!json.isString())
     {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not a string:") << json;
         return false;
     }
 
-    *value = stringValue.toStdString();
+    // The string is read directly so that it isn't interned, only the converted value is kept
+    const QString stringValue = json.toString();
+
+    // Encode directly into the string (this also reuses its capacity)
+    value->resize(Internal::encodeUtf8(stringValue, nullptr));
+    Internal::encodeUtf8(stringValue, &(*value)[0]);
     return true;
 }
 
@@ -711,14 +1209,31 @@ template<>
 bool deserialize(const QJsonValue &json, std::wstring *value)
 {
     Q_ASSERT(value != nullptr);
-    QString stringValue;
 
-    if (!deserialize(json, &stringValue))
+    if (!json.isString())
     {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not a string:") << json;
         return false;
     }
 
-    *value = stringValue.toStdWString();
+    // The string is read directly so that it isn't interned, only the converted value is kept
+    const QString stringValue = json.toString();
+
+    if (sizeof(wchar_t) == sizeof(QChar))
+    {
+        // UTF-16
+        value->assign(reinterpret_cast<const wchar_t *>(stringValue.utf16()),
+                      static_cast<std::size_t>(stringValue.size()));
+    }
+    else
+    {
+        // UTF-32
+        value->resize(static_cast<std::size_t>(stringValue.size()));
+        value->resize(Internal::utf16ToUtf32(stringValue.constData(), stringValue.size(),
+                                             &(*value)[0]));
+    }
+
     return true;
 }
 
@@ -728,14 +1243,19 @@ template<>
 bool deserialize(const QJsonValue &json, std::u16string *value)
 {
     Q_ASSERT(value != nullptr);
-    QString stringValue;
 
-    if (!deserialize(json, &stringValue))
+    if (!json.isString())
     {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not a string:") << json;
         return false;
     }
 
-    *value = stringValue.toStdU16String();
+    // The string is read directly so that it isn't interned, only the converted value is kept
+    const QString stringValue = json.toString();
+
+    value->assign(reinterpret_cast<const char16_t *>(stringValue.utf16()),
+                  static_cast<std::size_t>(stringValue.size()));
     return true;
 }
 
@@ -745,14 +1265,20 @@ template<>
 bool deserialize(const QJsonValue &json, std::u32string *value)
 {
     Q_ASSERT(value != nullptr);
-    QString stringValue;
 
-    if (!deserialize(json, &stringValue))
+    if (!json.isString())
     {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not a string:") << json;
         return false;
     }
 
-    *value = stringValue.toStdU32String();
+    // The string is read directly so that it isn't interned, only the converted value is kept
+    const QString stringValue = json.toString();
+
+    value->resize(static_cast<std::size_t>(stringValue.size()));
+    value->resize(Internal::utf16ToUtf32(stringValue.constData(), stringValue.size(),
+                                         &(*value)[0]));
     return true;
 }
 
@@ -763,9 +1289,14 @@ bool deserialize(const QJsonValue &json, QDate *value)
 {
     Q_ASSERT(value != nullptr);
 
+    if ((activeEncodingProfile().date == Encoding::Compact) && json.isDouble())
+    {
+        return Internal::convertJulianDayValue(json, value);
+    }
+
     if (!json.isString())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid date:") << json;
         return false;
     }
@@ -778,11 +1309,11 @@ bool deserialize(const QJsonValue &json, QDate *value)
         return true;
     }
 
-    *value = QDate::fromString(stringValue, Qt::ISODate);
+    *value = Internal::parseIsoDate(stringValue);
 
     if (!value->isValid())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
                 << QString("The value [%1] doesn't represent a date value in ISO format")
                    .arg(stringValue);
         return false;
@@ -798,9 +1329,14 @@ bool deserialize(const QJsonValue &json, QTime *value)
 {
     Q_ASSERT(value != nullptr);
 
+    if ((activeEncodingProfile().time == Encoding::Compact) && json.isDouble())
+    {
+        return Internal::convertTimeValue(json, value);
+    }
+
     if (!json.isString())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid time:") << json;
         return false;
     }
@@ -813,11 +1349,11 @@ bool deserialize(const QJsonValue &json, QTime *value)
         return true;
     }
 
-    *value = QTime::fromString(stringValue, Qt::ISODateWithMs);
+    *value = Internal::parseIsoTime(stringValue);
 
     if (!value->isValid())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
                 << QString("The value [%1] doesn't represent a time value in ISO format")
                    .arg(stringValue);
         return false;
@@ -833,9 +1369,15 @@ bool deserialize(const QJsonValue &json, QDateTime *value)
 {
     Q_ASSERT(value != nullptr);
 
+    if ((activeEncodingProfile().dateTime == Encoding::Compact) &&
+        (json.isDouble() || json.isArray()))
+    {
+        return Internal::convertDateTimeValue(json, value);
+    }
+
     if (!json.isString())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid date and time:") << json;
         return false;
     }
@@ -848,11 +1390,11 @@ bool deserialize(const QJsonValue &json, QDateTime *value)
         return true;
     }
 
-    *value = QDateTime::fromString(stringValue, Qt::ISODateWithMs);
+    *value = Internal::parseIsoDateTime(stringValue);
 
     if (!value->isValid())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
                 << QString("The value [%1] doesn't represent a date and time value in ISO format")
                    .arg(stringValue);
         return false;
@@ -866,8 +1408,18 @@ bool deserialize(const QJsonValue &json, QDateTime *value)
 template<>
 bool deserialize(const QJsonValue &json, QVariant *value)
 {
-    // TODO: reimplement this if support is added for "full encoding" (variant type and serialized
-    //       value)?
+    Q_ASSERT(value != nullptr);
+
+    // Deserialize the properties if the output already holds a Q_GADGET value
+    if ((value->userType() >= QMetaType::User) &&
+        QMetaType::typeFlags(value->userType()).testFlag(QMetaType::IsGadget))
+    {
+        return deserializeGadget(json,
+                                 value->data(),
+                                 *QMetaType::metaObjectForType(value->userType()));
+    }
+
+    // The type of the value is only known with the typed encoding (see deserializeTypedVariant())
     *value = json.toVariant();
     return true;
 }
@@ -881,18 +1433,26 @@ bool deserialize(const QJsonValue &json, QUrl *value)
 
     if (!json.isString())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid URL:") << json;
         return false;
     }
 
     const QString stringValue = json.toString();
+    InterningPool *pool = activeInterningPool();
 
-    value->setUrl(stringValue);
+    if (pool != nullptr)
+    {
+        *value = pool->url(stringValue);
+    }
+    else
+    {
+        value->setUrl(stringValue);
+    }
 
     if ((!value->isValid()) && (!stringValue.isEmpty()))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
                 << QString("The value [%1] doesn't represent an URL value")
                    .arg(stringValue);
         return false;
@@ -910,25 +1470,20 @@ bool deserialize(const QJsonValue &json, QUuid *value)
 
     if (!json.isString())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid UUID:") << json;
         return false;
     }
 
     const QString stringValue = json.toString();
 
-    *value = QUuid(stringValue);
-
-    if (value->isNull() &&
-        (stringValue != QStringLiteral("{00000000-0000-0000-0000-000000000000}")))
+    if ((activeEncodingProfile().uuid == Encoding::Compact) &&
+        (stringValue.size() == Internal::compactUuidSize))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
-                << QString("The value [%1] doesn't represent an UUID value")
-                   .arg(stringValue);
-        return false;
+        return Internal::convertCompactUuidValue(stringValue, value);
     }
 
-    return true;
+    return Internal::convertUuidValue(stringValue, value);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -940,12 +1495,13 @@ bool deserialize(const QJsonValue &json, QLocale *value)
 
     if (!json.isString())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid locale:") << json;
         return false;
     }
 
-    *value = QLocale(json.toString());
+    InterningPool *pool = activeInterningPool();
+    *value = (pool != nullptr) ? pool->locale(json.toString()) : QLocale(json.toString());
     return true;
 }
 
@@ -959,7 +1515,7 @@ bool deserialize(const QJsonValue &json, QRegExp *value)
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid QRegExp:") << json;
         return false;
     }
@@ -968,7 +1524,7 @@ bool deserialize(const QJsonValue &json, QRegExp *value)
 
     if (jsonObject.size() != 3)
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
                 << QString("A QRegExp needs to have exactly 3 members but this one has %1! JSON "
                            "value:").arg(jsonObject.size())
                 << jsonObject;
@@ -980,7 +1536,8 @@ bool deserialize(const QJsonValue &json, QRegExp *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("pattern")), &pattern))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("pattern"))
                 << QStringLiteral("Failed to deserialize the member 'pattern' of a QRegExp:")
                 << jsonObject;
         return false;
@@ -990,7 +1547,8 @@ bool deserialize(const QJsonValue &json, QRegExp *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("case_sensitive")), &caseSensitive))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("case_sensitive"))
                 << QStringLiteral("Failed to deserialize the member 'case_sensitive' of a QRegExp:")
                 << jsonObject;
         return false;
@@ -1000,7 +1558,8 @@ bool deserialize(const QJsonValue &json, QRegExp *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("syntax")), &syntax))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("syntax"))
                 << QStringLiteral("Failed to deserialize the member 'syntax' of a QRegExp:")
                 << jsonObject;
         return false;
@@ -1018,15 +1577,15 @@ bool deserialize(const QJsonValue &json, QRegExp *value)
 
     if (!syntaxMap.contains(syntax))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
                 << QStringLiteral("Invalid 'syntax' member of the QRegExp:") << syntax;
         return false;
     }
 
-    *value = QRegExp(pattern,
-                     caseSensitive ? Qt::CaseSensitive
-                                   : Qt::CaseInsensitive,
-                     syntaxMap.value(syntax));
+    *value = cachedRegExp(pattern,
+                          caseSensitive ? Qt::CaseSensitive
+                                        : Qt::CaseInsensitive,
+                          syntaxMap.value(syntax));
     return true;
 }
 
@@ -1040,7 +1599,7 @@ bool deserialize(const QJsonValue &json, QRegularExpression *value)
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid QRegularExpression:") << json;
         return false;
     }
@@ -1049,7 +1608,7 @@ bool deserialize(const QJsonValue &json, QRegularExpression *value)
 
     if (jsonObject.size() != 2)
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
                 << QString("A QRegularExpression needs to have exactly 2 members but this one has "
                            "%1! JSON value:").arg(jsonObject.size())
                 << jsonObject;
@@ -1061,7 +1620,8 @@ bool deserialize(const QJsonValue &json, QRegularExpression *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("pattern")), &pattern))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("pattern"))
                 << QStringLiteral("Failed to deserialize the member 'pattern' of a "
                                   "QRegularExpression:")
                 << jsonObject;
@@ -1072,7 +1632,8 @@ bool deserialize(const QJsonValue &json, QRegularExpression *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("options")), &options))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("options"))
                 << QStringLiteral("Failed to deserialize the member 'options' of a "
                                   "QRegularExpression:")
                 << jsonObject;
@@ -1104,7 +1665,7 @@ bool deserialize(const QJsonValue &json, QRegularExpression *value)
     {
         if (!syntaxMap.contains(item))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
                     << QString("Unsupported option [%1] in the 'options' member of a "
                                "QRegularExpression").arg(item);
             return false;
@@ -1113,7 +1674,7 @@ bool deserialize(const QJsonValue &json, QRegularExpression *value)
         optionFlags.setFlag(syntaxMap.value(item));
     }
 
-    *value = QRegularExpression(pattern, optionFlags);
+    *value = cachedRegularExpression(pattern, optionFlags);
     return true;
 }
 
@@ -1124,10 +1685,24 @@ bool deserialize(const QJsonValue &json, QSize *value)
 {
     Q_ASSERT(value != nullptr);
 
+    // Get the JSON Array representation (compact encoding)
+    if ((activeEncodingProfile().geometry == Encoding::Compact) && json.isArray())
+    {
+        int members[2];
+
+        if (!Internal::deserializePositional(json.toArray(), "size", members))
+        {
+            return false;
+        }
+
+        *value = QSize(members[0], members[1]);
+        return true;
+    }
+
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid size:") << json;
         return false;
     }
@@ -1136,7 +1711,7 @@ bool deserialize(const QJsonValue &json, QSize *value)
 
     if (jsonObject.size() != 2)
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
                 << QString("A size needs to have exactly 2 members but this one has %1! JSON "
                            "value:").arg(jsonObject.size())
                 << jsonObject;
@@ -1148,7 +1723,8 @@ bool deserialize(const QJsonValue &json, QSize *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("width")), &width))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("width"))
                 << QStringLiteral("Failed to deserialize the member 'width' of a size:")
                 << jsonObject;
         return false;
@@ -1158,7 +1734,8 @@ bool deserialize(const QJsonValue &json, QSize *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("height")), &height))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("height"))
                 << QStringLiteral("Failed to deserialize the member 'height' of a size:")
                 << jsonObject;
         return false;
@@ -1176,10 +1753,24 @@ bool deserialize(const QJsonValue &json, QSizeF *value)
 {
     Q_ASSERT(value != nullptr);
 
+    // Get the JSON Array representation (compact encoding)
+    if ((activeEncodingProfile().geometry == Encoding::Compact) && json.isArray())
+    {
+        qreal members[2];
+
+        if (!Internal::deserializePositional(json.toArray(), "size", members))
+        {
+            return false;
+        }
+
+        *value = QSizeF(members[0], members[1]);
+        return true;
+    }
+
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid size:") << json;
         return false;
     }
@@ -1188,7 +1779,7 @@ bool deserialize(const QJsonValue &json, QSizeF *value)
 
     if (jsonObject.size() != 2)
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
                 << QString("A size needs to have exactly 2 members but this one has %1! JSON "
                            "value:").arg(jsonObject.size())
                 << jsonObject;
@@ -1200,7 +1791,8 @@ bool deserialize(const QJsonValue &json, QSizeF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("width")), &width))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("width"))
                 << QStringLiteral("Failed to deserialize the member 'width' of a size:")
                 << jsonObject;
         return false;
@@ -1210,7 +1802,8 @@ bool deserialize(const QJsonValue &json, QSizeF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("height")), &height))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("height"))
                 << QStringLiteral("Failed to deserialize the member 'height' of a size:")
                 << jsonObject;
         return false;
@@ -1228,10 +1821,24 @@ bool deserialize(const QJsonValue &json, QPoint *value)
 {
     Q_ASSERT(value != nullptr);
 
+    // Get the JSON Array representation (compact encoding)
+    if ((activeEncodingProfile().geometry == Encoding::Compact) && json.isArray())
+    {
+        int members[2];
+
+        if (!Internal::deserializePositional(json.toArray(), "point", members))
+        {
+            return false;
+        }
+
+        *value = QPoint(members[0], members[1]);
+        return true;
+    }
+
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid point:") << json;
         return false;
     }
@@ -1240,7 +1847,7 @@ bool deserialize(const QJsonValue &json, QPoint *value)
 
     if (jsonObject.size() != 2)
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
                 << QString("A point needs to have exactly 2 members but this one has %1! JSON "
                            "value:").arg(jsonObject.size())
                 << jsonObject;
@@ -1252,7 +1859,8 @@ bool deserialize(const QJsonValue &json, QPoint *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("x")), &x))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("x"))
                 << QStringLiteral("Failed to deserialize the member 'x' of a point:")
                 << jsonObject;
         return false;
@@ -1262,7 +1870,8 @@ bool deserialize(const QJsonValue &json, QPoint *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("y")), &y))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("y"))
                 << QStringLiteral("Failed to deserialize the member 'y' of a point:")
                 << jsonObject;
         return false;
@@ -1280,10 +1889,24 @@ bool deserialize(const QJsonValue &json, QPointF *value)
 {
     Q_ASSERT(value != nullptr);
 
+    // Get the JSON Array representation (compact encoding)
+    if ((activeEncodingProfile().geometry == Encoding::Compact) && json.isArray())
+    {
+        qreal members[2];
+
+        if (!Internal::deserializePositional(json.toArray(), "point", members))
+        {
+            return false;
+        }
+
+        *value = QPointF(members[0], members[1]);
+        return true;
+    }
+
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid point:") << json;
         return false;
     }
@@ -1292,7 +1915,7 @@ bool deserialize(const QJsonValue &json, QPointF *value)
 
     if (jsonObject.size() != 2)
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
                 << QString("A point needs to have exactly 2 members but this one has %1! JSON "
                            "value:").arg(jsonObject.size())
                 << jsonObject;
@@ -1304,7 +1927,8 @@ bool deserialize(const QJsonValue &json, QPointF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("x")), &x))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("x"))
                 << QStringLiteral("Failed to deserialize the member 'x' of a point:")
                 << jsonObject;
         return false;
@@ -1314,7 +1938,8 @@ bool deserialize(const QJsonValue &json, QPointF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("y")), &y))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("y"))
                 << QStringLiteral("Failed to deserialize the member 'y' of a point:")
                 << jsonObject;
         return false;
@@ -1332,10 +1957,24 @@ bool deserialize(const QJsonValue &json, QLine *value)
 {
     Q_ASSERT(value != nullptr);
 
+    // Get the JSON Array representation (compact encoding)
+    if ((activeEncodingProfile().geometry == Encoding::Compact) && json.isArray())
+    {
+        int members[4];
+
+        if (!Internal::deserializePositional(json.toArray(), "line", members))
+        {
+            return false;
+        }
+
+        *value = QLine(members[0], members[1], members[2], members[3]);
+        return true;
+    }
+
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid line:") << json;
         return false;
     }
@@ -1344,7 +1983,7 @@ bool deserialize(const QJsonValue &json, QLine *value)
 
     if (jsonObject.size() != 4)
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
                 << QString("A line needs to have exactly 4 members but this one has %1! JSON "
                            "value:").arg(jsonObject.size())
                 << jsonObject;
@@ -1356,7 +1995,8 @@ bool deserialize(const QJsonValue &json, QLine *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("x1")), &x1))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("x1"))
                 << QStringLiteral("Failed to deserialize the member 'x1' of a line:")
                 << jsonObject;
         return false;
@@ -1366,7 +2006,8 @@ bool deserialize(const QJsonValue &json, QLine *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("x2")), &x2))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("x2"))
                 << QStringLiteral("Failed to deserialize the member 'x2' of a line:")
                 << jsonObject;
         return false;
@@ -1376,7 +2017,8 @@ bool deserialize(const QJsonValue &json, QLine *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("y1")), &y1))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("y1"))
                 << QStringLiteral("Failed to deserialize the member 'y1' of a line:")
                 << jsonObject;
         return false;
@@ -1386,7 +2028,8 @@ bool deserialize(const QJsonValue &json, QLine *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("y2")), &y2))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("y2"))
                 << QStringLiteral("Failed to deserialize the member 'y2' of a line:")
                 << jsonObject;
         return false;
@@ -1403,10 +2046,24 @@ bool deserialize(const QJsonValue &json, QLineF *value)
 {
     Q_ASSERT(value != nullptr);
 
+    // Get the JSON Array representation (compact encoding)
+    if ((activeEncodingProfile().geometry == Encoding::Compact) && json.isArray())
+    {
+        qreal members[4];
+
+        if (!Internal::deserializePositional(json.toArray(), "line", members))
+        {
+            return false;
+        }
+
+        *value = QLineF(members[0], members[1], members[2], members[3]);
+        return true;
+    }
+
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid line:") << json;
         return false;
     }
@@ -1415,7 +2072,7 @@ bool deserialize(const QJsonValue &json, QLineF *value)
 
     if (jsonObject.size() != 4)
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
                 << QString("A line needs to have exactly 4 members but this one has %1! JSON "
                            "value:").arg(jsonObject.size())
                 << jsonObject;
@@ -1427,7 +2084,8 @@ bool deserialize(const QJsonValue &json, QLineF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("x1")), &x1))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("x1"))
                 << QStringLiteral("Failed to deserialize the member 'x1' of a line:")
                 << jsonObject;
         return false;
@@ -1437,7 +2095,8 @@ bool deserialize(const QJsonValue &json, QLineF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("x2")), &x2))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("x2"))
                 << QStringLiteral("Failed to deserialize the member 'x2' of a line:")
                 << jsonObject;
         return false;
@@ -1447,7 +2106,8 @@ bool deserialize(const QJsonValue &json, QLineF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("y1")), &y1))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("y1"))
                 << QStringLiteral("Failed to deserialize the member 'y1' of a line:")
                 << jsonObject;
         return false;
@@ -1457,7 +2117,8 @@ bool deserialize(const QJsonValue &json, QLineF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("y2")), &y2))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("y2"))
                 << QStringLiteral("Failed to deserialize the member 'y2' of a line:")
                 << jsonObject;
         return false;
@@ -1474,10 +2135,24 @@ bool deserialize(const QJsonValue &json, QRect *value)
 {
     Q_ASSERT(value != nullptr);
 
+    // Get the JSON Array representation (compact encoding)
+    if ((activeEncodingProfile().geometry == Encoding::Compact) && json.isArray())
+    {
+        int members[4];
+
+        if (!Internal::deserializePositional(json.toArray(), "rectangle", members))
+        {
+            return false;
+        }
+
+        *value = QRect(members[0], members[1], members[2], members[3]);
+        return true;
+    }
+
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid rectangle:") << json;
         return false;
     }
@@ -1486,7 +2161,7 @@ bool deserialize(const QJsonValue &json, QRect *value)
 
     if (jsonObject.size() != 4)
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
                 << QString("A rectangle needs to have exactly 4 members but this one has %1! JSON "
                            "value:").arg(jsonObject.size())
                 << jsonObject;
@@ -1498,7 +2173,8 @@ bool deserialize(const QJsonValue &json, QRect *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("x")), &x))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("x"))
                 << QStringLiteral("Failed to deserialize the member 'x' of a rectangle:")
                 << jsonObject;
         return false;
@@ -1508,7 +2184,8 @@ bool deserialize(const QJsonValue &json, QRect *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("y")), &y))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("y"))
                 << QStringLiteral("Failed to deserialize the member 'y' of a rectangle:")
                 << jsonObject;
         return false;
@@ -1518,7 +2195,8 @@ bool deserialize(const QJsonValue &json, QRect *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("width")), &width))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("width"))
                 << QStringLiteral("Failed to deserialize the member 'width' of a rectangle:")
                 << jsonObject;
         return false;
@@ -1528,7 +2206,8 @@ bool deserialize(const QJsonValue &json, QRect *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("height")), &height))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("height"))
                 << QStringLiteral("Failed to deserialize the member 'height' of a rectangle:")
                 << jsonObject;
         return false;
@@ -1549,10 +2228,24 @@ bool deserialize(const QJsonValue &json, QRectF *value)
 {
     Q_ASSERT(value != nullptr);
 
+    // Get the JSON Array representation (compact encoding)
+    if ((activeEncodingProfile().geometry == Encoding::Compact) && json.isArray())
+    {
+        qreal members[4];
+
+        if (!Internal::deserializePositional(json.toArray(), "rectangle", members))
+        {
+            return false;
+        }
+
+        *value = QRectF(members[0], members[1], members[2], members[3]);
+        return true;
+    }
+
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid rectangle:") << json;
         return false;
     }
@@ -1561,7 +2254,7 @@ bool deserialize(const QJsonValue &json, QRectF *value)
 
     if (jsonObject.size() != 4)
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
                 << QString("A rectangle needs to have exactly 4 members but this one has %1! JSON "
                            "value:").arg(jsonObject.size())
                 << jsonObject;
@@ -1573,7 +2266,8 @@ bool deserialize(const QJsonValue &json, QRectF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("x")), &x))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("x"))
                 << QStringLiteral("Failed to deserialize the member 'x' of a rectangle:")
                 << jsonObject;
         return false;
@@ -1583,7 +2277,8 @@ bool deserialize(const QJsonValue &json, QRectF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("y")), &y))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("y"))
                 << QStringLiteral("Failed to deserialize the member 'y' of a rectangle:")
                 << jsonObject;
         return false;
@@ -1593,7 +2288,8 @@ bool deserialize(const QJsonValue &json, QRectF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("width")), &width))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("width"))
                 << QStringLiteral("Failed to deserialize the member 'width' of a rectangle:")
                 << jsonObject;
         return false;
@@ -1603,7 +2299,8 @@ bool deserialize(const QJsonValue &json, QRectF *value)
 
     if (!deserialize(jsonObject.value(QStringLiteral("height")), &height))
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("height"))
                 << QStringLiteral("Failed to deserialize the member 'height' of a rectangle:")
                 << jsonObject;
         return false;
@@ -1627,7 +2324,7 @@ bool deserialize(const QJsonValue &json, QStringList *value)
     // Get the JSON Array representation
     if (!json.isArray())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid string list:") << json;
         return false;
     }
@@ -1644,7 +2341,7 @@ bool deserialize(const QJsonValue &json, QStringList *value)
 
         if (!deserialize(item, &deserializedItem))
         {
-            qCWarning(CedarFramework::LoggingCategory::Deserialization)
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, index)
                     << QString("Failed to deserialize the string list element at index [%1]! JSON "
                                "value:").arg(index)
                     << jsonArray;
@@ -1679,7 +2376,7 @@ bool deserialize(const QJsonValue &json, QJsonArray *value)
     // Get the JSON Array representation
     if (!json.isArray())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid JSON array:") << json;
         return false;
     }
@@ -1698,7 +2395,7 @@ bool deserialize(const QJsonValue &json, QJsonObject *value)
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid JSON object:") << json;
         return false;
     }
@@ -1732,7 +2429,7 @@ bool deserialize(const QJsonValue &json, QJsonDocument *value)
         return true;
     }
 
-    qCWarning(CedarFramework::LoggingCategory::Deserialization)
+    CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
             << QStringLiteral("Failed to deserialize the JSON value to a JSON document:") << json;
     return false;
 }
@@ -1761,7 +2458,7 @@ bool deserialize(const QJsonValue &json, QCborArray *value)
     // Get the JSON Array representation
     if (!json.isArray())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid CBOR array:") << json;
         return false;
     }
@@ -1782,7 +2479,7 @@ bool deserialize(const QJsonValue &json, QCborMap *value)
     // Get the JSON Object representation
     if (!json.isObject())
     {
-        qCWarning(CedarFramework::LoggingCategory::Deserialization)
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
                 << QStringLiteral("JSON value is not a valid CBOR map:") << json;
         return false;
     }
@@ -1819,11 +2516,197 @@ bool deserialize(const QJsonValue &json, QCborSimpleType *value)
         return true;
     }
 
-    qCWarning(CedarFramework::LoggingCategory::Deserialization)
+    CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
             << QStringLiteral("Failed to deserialize the JSON value to a CBOR simple type:")
             << json;
     return false;
 }
 #endif
 
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, signed char *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    return Internal::convertIntegerValue(value, key);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, unsigned char *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    return Internal::convertIntegerValue(value, key);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, short *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    return Internal::convertIntegerValue(value, key);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, unsigned short *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    return Internal::convertIntegerValue(value, key);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, int *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    return Internal::convertIntegerValue(value, key);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, unsigned int *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    return Internal::convertIntegerValue(value, key);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, long *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    return Internal::convertIntegerValue(value, key);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, unsigned long *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    return Internal::convertIntegerValue(value, key);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, long long *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    return Internal::convertIntegerValue(value, key);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, unsigned long long *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    return Internal::convertIntegerValue(value, key);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, QString *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    InterningPool *pool = activeInterningPool();
+    *key = (pool != nullptr) ? pool->string(value) : value;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, std::string *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    key->resize(Internal::encodeUtf8(value, nullptr));
+    Internal::encodeUtf8(value, &(*key)[0]);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+bool deserializeKey(const QString &value, QUuid *key)
+{
+    Q_ASSERT(key != nullptr);
+
+    return Internal::convertUuidValue(value, key);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Explicit instantiations
+// -------------------------------------------------------------------------------------------------
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QList<int> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QList<double> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QList<QString> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QList<QVariant> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QVector<int> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QVector<double> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QVector<QString> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, std::vector<int> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, std::vector<double> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, std::vector<QString> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QMap<QString, int> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QMap<QString, double> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QMap<QString, QString> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QMap<QString, QVariant> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QHash<QString, QString> *);
+
+template
+CEDARFRAMEWORK_EXPORT bool deserialize(const QJsonValue &, QHash<QString, QVariant> *);
+
 } // namespace CedarFramework
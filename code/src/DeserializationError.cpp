@@ -0,0 +1,377 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the reporting of deserialization errors
+ */
+
+// Own header
+#include <CedarFramework/DeserializationError.hpp>
+
+// Cedar Framework includes
+#include <CedarFramework/LoggingCategories.hpp>
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+//! Error sink that is used when no other error sink is active
+DeserializationErrorLogger defaultDeserializationErrorSink;
+
+//! Error sink that is active in the current thread
+thread_local DeserializationErrorSink *currentDeserializationErrorSink = nullptr;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the name of the error code
+ *
+ * \param   code    Error code
+ *
+ * \return  Name of the error code
+ */
+QString errorCodeName(const DeserializationErrorCode code)
+{
+    switch (code)
+    {
+        case DeserializationErrorCode::InvalidType:
+        {
+            return QStringLiteral("InvalidType");
+        }
+
+        case DeserializationErrorCode::InvalidValue:
+        {
+            return QStringLiteral("InvalidValue");
+        }
+
+        case DeserializationErrorCode::OutOfRange:
+        {
+            return QStringLiteral("OutOfRange");
+        }
+
+        case DeserializationErrorCode::InvalidSize:
+        {
+            return QStringLiteral("InvalidSize");
+        }
+
+        case DeserializationErrorCode::DuplicateItem:
+        {
+            return QStringLiteral("DuplicateItem");
+        }
+
+        case DeserializationErrorCode::ItemFailed:
+        {
+            return QStringLiteral("ItemFailed");
+        }
+
+        case DeserializationErrorCode::NodeNotFound:
+        {
+            return QStringLiteral("NodeNotFound");
+        }
+    }
+
+    return {};
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+// DeserializationErrorSink
+// -------------------------------------------------------------------------------------------------
+
+DeserializationErrorSink::~DeserializationErrorSink() = default;
+
+// -------------------------------------------------------------------------------------------------
+
+bool DeserializationErrorSink::isMessageEnabled() const
+{
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+// DeserializationErrorLogger
+// -------------------------------------------------------------------------------------------------
+
+bool DeserializationErrorLogger::isMessageEnabled() const
+{
+    return CedarFramework::LoggingCategory::Deserialization.isWarningEnabled();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void DeserializationErrorLogger::reportError(DeserializationErrorCode code,
+                                             const QVariant &pathElement,
+                                             const QString &message)
+{
+    Q_UNUSED(code);
+    Q_UNUSED(pathElement);
+
+    qCWarning(CedarFramework::LoggingCategory::Deserialization).noquote() << message;
+}
+
+// -------------------------------------------------------------------------------------------------
+// DeserializationErrorCollector
+// -------------------------------------------------------------------------------------------------
+
+bool DeserializationErrorCollector::hasError() const
+{
+    return m_hasError;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+DeserializationErrorCode DeserializationErrorCollector::errorCode() const
+{
+    return m_errorCode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QVariantList DeserializationErrorCollector::path() const
+{
+    return m_path;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString DeserializationErrorCollector::toString() const
+{
+    if (!m_hasError)
+    {
+        return {};
+    }
+
+    QString text = Internal::errorCodeName(m_errorCode);
+
+    if (m_path.isEmpty())
+    {
+        return text;
+    }
+
+    text.append(QStringLiteral(" at "));
+
+    for (int i = 0; i < m_path.size(); i++)
+    {
+        const QVariant &pathElement = m_path.at(i);
+
+        if (pathElement.type() == QVariant::Int)
+        {
+            text.append(QString("[%1]").arg(pathElement.toInt()));
+        }
+        else
+        {
+            if (i > 0)
+            {
+                text.append(QLatin1Char('.'));
+            }
+
+            text.append(pathElement.toString());
+        }
+    }
+
+    return text;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void DeserializationErrorCollector::clear()
+{
+    m_hasError = false;
+    m_pathComplete = false;
+    m_errorCode = DeserializationErrorCode::InvalidValue;
+    m_path.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void DeserializationErrorCollector::reportError(DeserializationErrorCode code,
+                                                const QVariant &pathElement,
+                                                const QString &message)
+{
+    Q_UNUSED(message);
+
+    // The first error is the one of the innermost value, the following ones are from the enclosing
+    // containers and they only extend the path. Any other error starts a new chain of errors which
+    // means that the path of the recorded error is complete.
+    if (!m_hasError)
+    {
+        m_hasError = true;
+        m_errorCode = code;
+    }
+    else if (code != DeserializationErrorCode::ItemFailed)
+    {
+        m_pathComplete = true;
+    }
+
+    if (m_pathComplete)
+    {
+        return;
+    }
+
+    if (pathElement.isValid())
+    {
+        m_path.prepend(pathElement);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Active error sink
+// -------------------------------------------------------------------------------------------------
+
+DeserializationErrorSink &activeDeserializationErrorSink()
+{
+    if (Internal::currentDeserializationErrorSink == nullptr)
+    {
+        return Internal::defaultDeserializationErrorSink;
+    }
+
+    return *Internal::currentDeserializationErrorSink;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+DeserializationErrorScope::DeserializationErrorScope(DeserializationErrorSink *sink)
+    : m_previousSink(Internal::currentDeserializationErrorSink)
+{
+    Internal::currentDeserializationErrorSink = sink;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+DeserializationErrorScope::~DeserializationErrorScope()
+{
+    Internal::currentDeserializationErrorSink = m_previousSink;
+}
+
+// -------------------------------------------------------------------------------------------------
+// DeserializationErrorReport
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+DeserializationErrorReport::DeserializationErrorReport(DeserializationErrorCode code)
+    : m_sink(activeDeserializationErrorSink()),
+      m_code(code),
+      m_pathElement(),
+      m_message(),
+      m_pending(true)
+{
+    initialize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+DeserializationErrorReport::DeserializationErrorReport(DeserializationErrorCode code, int index)
+    : m_sink(activeDeserializationErrorSink()),
+      m_code(code),
+      m_pathElement(index),
+      m_message(),
+      m_pending(true)
+{
+    initialize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+DeserializationErrorReport::DeserializationErrorReport(DeserializationErrorCode code,
+                                                       const QString &name)
+    : m_sink(activeDeserializationErrorSink()),
+      m_code(code),
+      m_pathElement(name),
+      m_message(),
+      m_pending(true)
+{
+    initialize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void DeserializationErrorReport::finish()
+{
+    // Remove the separator that the stream adds after the last item
+    if (m_message.endsWith(QLatin1Char(' ')))
+    {
+        m_message.chop(1);
+    }
+
+    m_pending = false;
+    m_sink.reportError(m_code, m_pathElement, m_message);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void DeserializationErrorReport::initialize()
+{
+    // Skip the formatting of the message if it is not needed
+    if (!m_sink.isMessageEnabled())
+    {
+        finish();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void reportNodePathError(DeserializationErrorCode code, const QVariantList &nodePath)
+{
+    // The elements are reported from the innermost one, the same as by the nested containers
+    for (int i = nodePath.size() - 1; i >= 0; i--)
+    {
+        const QVariant &pathElement = nodePath.at(i);
+
+        if (pathElement.type() == QVariant::String)
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(code, pathElement.toString())
+                    << QStringLiteral("Failed at the node:") << pathElement.toString();
+        }
+        else
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(code, pathElement.toInt())
+                    << QStringLiteral("Failed at the node:") << pathElement.toInt();
+        }
+
+        code = DeserializationErrorCode::ItemFailed;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void reportNodePathError(DeserializationErrorCode code, const QStringList &nodePath)
+{
+    for (int i = nodePath.size() - 1; i >= 0; i--)
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(code, nodePath.at(i))
+                << QStringLiteral("Failed at the node:") << nodePath.at(i);
+
+        code = DeserializationErrorCode::ItemFailed;
+    }
+}
+
+} // namespace Internal
+
+} // namespace CedarFramework
@@ -0,0 +1,121 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the encoding profile used for serialization and deserialization of the types that have
+ * an alternative compact encoding
+ */
+
+// Own header
+#include <CedarFramework/Encoding.hpp>
+
+// Cedar Framework includes
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+//! Encoding profile that is active in the current thread
+thread_local EncodingProfile activeEncodingProfile;
+
+//! Flag that indicates that the SIMD code paths can be used in the current thread
+thread_local bool simdEnabled = true;
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+EncodingProfile EncodingProfile::text()
+{
+    return EncodingProfile();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+EncodingProfile EncodingProfile::compact()
+{
+    EncodingProfile profile;
+    profile.date = Encoding::Compact;
+    profile.time = Encoding::Compact;
+    profile.dateTime = Encoding::Compact;
+    profile.uuid = Encoding::Compact;
+    profile.geometry = Encoding::Compact;
+    profile.pair = Encoding::Compact;
+    return profile;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const EncodingProfile &activeEncodingProfile()
+{
+    return Internal::activeEncodingProfile;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+EncodingScope::EncodingScope(const EncodingProfile &profile)
+    : m_previousProfile(Internal::activeEncodingProfile)
+{
+    Internal::activeEncodingProfile = profile;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+EncodingScope::~EncodingScope()
+{
+    Internal::activeEncodingProfile = m_previousProfile;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+bool isSimdEnabled()
+{
+    return simdEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ScalarCodeScope::ScalarCodeScope()
+    : m_previousState(simdEnabled)
+{
+    simdEnabled = false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ScalarCodeScope::~ScalarCodeScope()
+{
+    simdEnabled = m_previousState;
+}
+
+} // namespace Internal
+
+} // namespace CedarFramework
@@ -0,0 +1,163 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the binding of JSON Object members to native values
+ */
+
+// Own header
+#include <CedarFramework/FieldBinder.hpp>
+
+// Cedar Framework includes
+
+// Qt includes
+#include <QtCore/QJsonObject>
+
+// System includes
+#include <algorithm>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+bool FieldBinder::deserialize(const QJsonValue &data, QStringList *unknownKeys) const
+{
+    if (unknownKeys != nullptr)
+    {
+        unknownKeys->clear();
+    }
+
+    for (const Binding &binding : m_bindings)
+    {
+        if (binding.deserialized != nullptr)
+        {
+            *binding.deserialized = false;
+        }
+    }
+
+    // Get the JSON Object representation
+    if (!data.isObject())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not an Object:") << data;
+        return false;
+    }
+
+    const auto jsonObject = data.toObject();
+
+    // Merge the members of the JSON Object with the bindings, both are sorted by their keys so in
+    // most cases the next binding is the matching one, otherwise it is searched for
+    const auto keyLessThan = [](const Binding &binding, const QString &key)
+    {
+        return binding.key < key;
+    };
+
+    std::vector<bool> found(static_cast<std::size_t>(m_bindings.size()), false);
+    auto nextBinding = m_bindings.cbegin();
+
+    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    {
+        const QString key = it.key();
+
+        if ((nextBinding == m_bindings.cend()) || (nextBinding->key != key))
+        {
+            nextBinding = std::lower_bound(m_bindings.cbegin(),
+                                           m_bindings.cend(),
+                                           key,
+                                           keyLessThan);
+
+            if ((nextBinding == m_bindings.cend()) || (nextBinding->key != key))
+            {
+                // Unknown member
+                if (unknownKeys != nullptr)
+                {
+                    unknownKeys->append(key);
+                }
+                continue;
+            }
+        }
+
+        const Binding &binding = *nextBinding;
+
+        if (!binding.deserializer(it.value(), binding.value))
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, key)
+                    << QStringLiteral("Failed to deserialize the member:") << key;
+            return false;
+        }
+
+        if (binding.deserialized != nullptr)
+        {
+            *binding.deserialized = true;
+        }
+
+        found[static_cast<std::size_t>(nextBinding - m_bindings.cbegin())] = true;
+        nextBinding++;
+    }
+
+    // Check if all of the required members were found and reset the missing optional members
+    for (int i = 0; i < m_bindings.size(); i++)
+    {
+        const Binding &binding = m_bindings.at(i);
+
+        if (found[static_cast<std::size_t>(i)])
+        {
+            continue;
+        }
+
+        if (binding.required)
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::NodeNotFound,
+                                                 binding.key)
+                    << QStringLiteral("JSON Object doesn't contain the member:") << binding.key;
+            return false;
+        }
+
+        binding.resetter(binding.value);
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void FieldBinder::addBinding(const Binding &binding)
+{
+    auto it = std::lower_bound(m_bindings.begin(),
+                               m_bindings.end(),
+                               binding.key,
+                               [](const Binding &item, const QString &key)
+                               {
+                                   return item.key < key;
+                               });
+
+    if ((it != m_bindings.end()) && (it->key == binding.key))
+    {
+        *it = binding;
+    }
+    else
+    {
+        m_bindings.insert(it, binding);
+    }
+}
+
+} // namespace CedarFramework
@@ -0,0 +1,407 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the interning of the deserialized values that are expensive to parse
+ */
+
+// Own header
+#include <CedarFramework/Interning.hpp>
+
+// Cedar Framework includes
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+//! Interning pool that is active in the current thread
+thread_local InterningPool *activeInterningPool = nullptr;
+
+//! Next lookup counter shard that is assigned to a thread
+std::atomic<unsigned int> nextCounterShard(0U);
+
+//! Lookup counter shard of the current thread, the threads are assigned to the shards in turn
+thread_local const unsigned int counterShard =
+        nextCounterShard.fetch_add(1U, std::memory_order_relaxed);
+
+//! Maximum length of the interned strings
+constexpr int maximumInternedStringLength = 64;
+
+//! Default maximum number of interned values in a pool
+constexpr int defaultInterningPoolCapacity = 65536;
+
+//! Maximum number of values of each type in the front cache of a thread
+constexpr int maximumFrontCacheSize = 1024;
+
+//! Next generation of the interned values of a pool
+std::atomic<quint64> nextGeneration(1U);
+
+//! Values of a pool that the current thread already looked up
+struct FrontCache
+{
+    //! Generation of the interned values of the pool (0 if the cache doesn't belong to a pool)
+    quint64 generation = 0U;
+
+    //! Looked up locales
+    QHash<QString, QLocale> locales;
+
+    //! Looked up URLs
+    QHash<QString, QUrl> urls;
+
+    //! Looked up strings
+    QHash<QString, QString> strings;
+};
+
+//! Front cache of the current thread
+thread_local FrontCache frontCache;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the front cache of the current thread for the interned values of a pool
+ *
+ * \param   generation  Generation of the interned values of the pool
+ *
+ * \return  Front cache, it is emptied if it belonged to another pool or generation
+ */
+FrontCache &threadFrontCache(const quint64 generation)
+{
+    if (frontCache.generation != generation)
+    {
+        frontCache.generation = generation;
+        frontCache.locales.clear();
+        frontCache.urls.clear();
+        frontCache.strings.clear();
+    }
+
+    return frontCache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Remembers an interned value in the front cache of the current thread
+ *
+ * \tparam  T   Value type
+ *
+ * \param   frontValues Values in the front cache
+ * \param   key         Input of the value
+ * \param   value       Interned value
+ *
+ * \return  Interned value
+ */
+template<typename T>
+T rememberValue(QHash<QString, T> *frontValues, const QString &key, const T &value)
+{
+    if (frontValues->size() >= maximumFrontCacheSize)
+    {
+        frontValues->clear();
+    }
+
+    frontValues->insert(key, value);
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the interned value
+ *
+ * \tparam  T           Value type
+ * \tparam  CanIntern   Type of the function that checks if the pool can take another value
+ *
+ * \param   lock        Lock for the interned values
+ * \param   values      Interned values
+ * \param   frontValues Values in the front cache of the current thread
+ * \param   key         Input of the value
+ * \param   canIntern   Function that checks if the pool can take another value, it is called
+ *                      while the lock is held for writing
+ * \param   hit         Output for the flag that indicates if the value was already interned
+ *
+ * \return  Interned value or the parsed value if the pool is full
+ */
+template<typename T, typename CanIntern>
+T internValue(QReadWriteLock *lock,
+              QHash<QString, T> *values,
+              QHash<QString, T> *frontValues,
+              const QString &key,
+              CanIntern canIntern,
+              bool *hit)
+{
+    // The values that the current thread already looked up are found without taking the lock
+    const auto frontIt = frontValues->constFind(key);
+
+    if (frontIt != frontValues->constEnd())
+    {
+        *hit = true;
+        return frontIt.value();
+    }
+
+    {
+        QReadLocker locker(lock);
+        const auto it = values->constFind(key);
+
+        if (it != values->constEnd())
+        {
+            *hit = true;
+            return rememberValue(frontValues, key, it.value());
+        }
+    }
+
+    *hit = false;
+
+    // The value is parsed without holding the lock, if another thread interned the same value in
+    // the meantime its value is used so that there is only a single instance of it
+    const T value(key);
+
+    QWriteLocker locker(lock);
+    auto it = values->find(key);
+
+    if (it == values->end())
+    {
+        if (!canIntern())
+        {
+            return value;
+        }
+
+        it = values->insert(key, value);
+    }
+
+    return rememberValue(frontValues, key, it.value());
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+InterningPool::InterningPool()
+    : InterningPool(Internal::defaultInterningPoolCapacity)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+InterningPool::InterningPool(const int capacity)
+    : m_lock(),
+      m_capacity(qMax(capacity, 0)),
+      m_generation(Internal::nextGeneration.fetch_add(1U, std::memory_order_relaxed)),
+      m_locales(),
+      m_urls(),
+      m_strings(),
+      m_counterShards()
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+InterningPool &InterningPool::global()
+{
+    static InterningPool pool;
+    return pool;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QLocale InterningPool::locale(const QString &name)
+{
+    const auto canIntern = [this]() { return internedCount() < m_capacity; };
+    bool hit = false;
+    Internal::FrontCache &frontCache =
+            Internal::threadFrontCache(m_generation.load(std::memory_order_acquire));
+    const QLocale value = Internal::internValue(&m_lock,
+                                                &m_locales,
+                                                &frontCache.locales,
+                                                name,
+                                                canIntern,
+                                                &hit);
+
+    countLookup(hit, 0);
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QUrl InterningPool::url(const QString &url)
+{
+    const auto canIntern = [this]() { return internedCount() < m_capacity; };
+    bool hit = false;
+    Internal::FrontCache &frontCache =
+            Internal::threadFrontCache(m_generation.load(std::memory_order_acquire));
+    const QUrl value = Internal::internValue(&m_lock,
+                                             &m_urls,
+                                             &frontCache.urls,
+                                             url,
+                                             canIntern,
+                                             &hit);
+
+    countLookup(hit, 0);
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString InterningPool::string(const QString &value)
+{
+    if (value.isEmpty() || (value.size() > Internal::maximumInternedStringLength))
+    {
+        return value;
+    }
+
+    const auto canIntern = [this]() { return internedCount() < m_capacity; };
+    bool hit = false;
+    Internal::FrontCache &frontCache =
+            Internal::threadFrontCache(m_generation.load(std::memory_order_acquire));
+    const QString internedValue = Internal::internValue(&m_lock,
+                                                        &m_strings,
+                                                        &frontCache.strings,
+                                                        value,
+                                                        canIntern,
+                                                        &hit);
+
+    countLookup(hit, hit ? (static_cast<quint64>(value.size()) * sizeof(QChar)) : 0);
+    return internedValue;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int InterningPool::size() const
+{
+    QReadLocker locker(&m_lock);
+    return internedCount();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int InterningPool::capacity() const
+{
+    QReadLocker locker(&m_lock);
+    return m_capacity;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void InterningPool::setCapacity(const int capacity)
+{
+    QWriteLocker locker(&m_lock);
+    m_capacity = qMax(capacity, 0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+InterningStatistics InterningPool::statistics() const
+{
+    InterningStatistics statistics = { 0, 0, 0 };
+
+    for (const CounterShard &shard : m_counterShards)
+    {
+        statistics.hits += shard.hits.load(std::memory_order_relaxed);
+        statistics.misses += shard.misses.load(std::memory_order_relaxed);
+        statistics.savedBytes += shard.savedBytes.load(std::memory_order_relaxed);
+    }
+
+    return statistics;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void InterningPool::clear()
+{
+    QWriteLocker locker(&m_lock);
+    m_locales.clear();
+    m_urls.clear();
+    m_strings.clear();
+
+    // Invalidate the front caches of the threads
+    m_generation.store(Internal::nextGeneration.fetch_add(1U, std::memory_order_relaxed),
+                       std::memory_order_release);
+
+    for (CounterShard &shard : m_counterShards)
+    {
+        shard.hits.store(0, std::memory_order_relaxed);
+        shard.misses.store(0, std::memory_order_relaxed);
+        shard.savedBytes.store(0, std::memory_order_relaxed);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int InterningPool::internedCount() const
+{
+    return m_locales.size() + m_urls.size() + m_strings.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void InterningPool::countLookup(const bool hit, const quint64 savedBytes)
+{
+    // The counters are only statistics, so they don't need to be ordered with the interned values.
+    // Each thread counts in its own shard so that the lookups in different threads don't contend
+    // for the same cache line.
+    CounterShard &shard = m_counterShards[Internal::counterShard % counterShardCount];
+
+    if (hit)
+    {
+        shard.hits.fetch_add(1, std::memory_order_relaxed);
+        shard.savedBytes.fetch_add(savedBytes, std::memory_order_relaxed);
+    }
+    else
+    {
+        shard.misses.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+#ifdef Q_OS_WIN
+namespace Internal
+{
+
+InterningPool *currentInterningPool()
+{
+    return activeInterningPool;
+}
+
+} // namespace Internal
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+InterningScope::InterningScope(InterningPool &pool)
+    : m_previousPool(Internal::activeInterningPool)
+{
+    Internal::activeInterningPool = &pool;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+InterningScope::~InterningScope()
+{
+    Internal::activeInterningPool = m_previousPool;
+}
+
+} // namespace CedarFramework
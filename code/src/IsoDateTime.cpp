@@ -0,0 +1,463 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a fixed-layout ISO 8601 codec for date and time values
+ */
+
+// Own header
+#include "IsoDateTime.hpp"
+
+// Cedar Framework includes
+
+// Qt includes
+
+// System includes
+#include <cstdlib>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+//! Size of the "yyyy-MM-dd" layout
+constexpr int isoDateSize = 10;
+
+//! Size of the "HH:mm:ss" layout
+constexpr int isoTimeSize = 8;
+
+//! Size of the "HH:mm:ss.zzz" layout
+constexpr int isoTimeWithMsSize = 12;
+
+//! Size of the "[+|-]HH:mm" layout
+constexpr int isoOffsetSize = 6;
+
+//! Maximum size of the "yyyy-MM-ddTHH:mm:ss.zzz[+|-]HH:mm" layout
+constexpr int isoDateTimeMaxSize = isoDateSize + 1 + isoTimeWithMsSize + isoOffsetSize;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Writes a zero-padded decimal number
+ *
+ * \param   output  Output buffer
+ * \param   value   Non-negative value
+ * \param   digits  Number of digits to write
+ *
+ * \return  Position in the output buffer after the written digits
+ */
+QChar *writeIsoNumber(QChar *output, int value, const int digits)
+{
+    for (int i = digits - 1; i >= 0; i--)
+    {
+        output[i] = QChar(static_cast<ushort>('0' + (value % 10)));
+        value /= 10;
+    }
+
+    return output + digits;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Reads a fixed-width decimal number
+ *
+ * \param   input   Input buffer
+ * \param   digits  Number of digits to read
+ * \param   value   Output for the value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure, a non-digit character was found
+ */
+bool readIsoNumber(const QChar *input, const int digits, int *value)
+{
+    int result = 0;
+
+    for (int i = 0; i < digits; i++)
+    {
+        const ushort character = input[i].unicode();
+
+        if ((character < '0') || (character > '9'))
+        {
+            return false;
+        }
+
+        result = (result * 10) + static_cast<int>(character - '0');
+    }
+
+    *value = result;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Writes the date in "yyyy-MM-dd" layout
+ *
+ * \param   output  Output buffer
+ * \param   value   Date value with a year in range [1, 9999]
+ *
+ * \return  Position in the output buffer after the written date
+ */
+QChar *writeIsoDate(QChar *output, const QDate &value)
+{
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    value.getDate(&year, &month, &day);
+
+    output = writeIsoNumber(output, year, 4);
+    *output++ = QLatin1Char('-');
+    output = writeIsoNumber(output, month, 2);
+    *output++ = QLatin1Char('-');
+    return writeIsoNumber(output, day, 2);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Writes the time in "HH:mm:ss.zzz" layout
+ *
+ * \param   output  Output buffer
+ * \param   value   Valid time value
+ *
+ * \return  Position in the output buffer after the written time
+ */
+QChar *writeIsoTime(QChar *output, const QTime &value)
+{
+    const int msecs = value.msecsSinceStartOfDay();
+
+    output = writeIsoNumber(output, msecs / 3600000, 2);
+    *output++ = QLatin1Char(':');
+    output = writeIsoNumber(output, (msecs / 60000) % 60, 2);
+    *output++ = QLatin1Char(':');
+    output = writeIsoNumber(output, (msecs / 1000) % 60, 2);
+    *output++ = QLatin1Char('.');
+    return writeIsoNumber(output, msecs % 1000, 3);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if the year of the date can be written in the "yyyy" layout
+ *
+ * \param   value   Date value
+ *
+ * \retval  true    Date has a four digit year
+ * \retval  false   Date is invalid or its year doesn't have four digits
+ */
+bool hasIsoYear(const QDate &value)
+{
+    if (!value.isValid())
+    {
+        return false;
+    }
+
+    const int year = value.year();
+    return (year >= 1) && (year <= 9999);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Reads the date from the "yyyy-MM-dd" layout
+ *
+ * \param   input   Input buffer with at least isoDateSize characters
+ * \param   value   Output for the date value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure, input doesn't represent a valid date in the expected layout
+ */
+bool readIsoDate(const QChar *input, QDate *value)
+{
+    int year = 0;
+    int month = 0;
+    int day = 0;
+
+    if ((!readIsoNumber(input, 4, &year)) ||
+        (input[4] != QLatin1Char('-')) ||
+        (!readIsoNumber(input + 5, 2, &month)) ||
+        (input[7] != QLatin1Char('-')) ||
+        (!readIsoNumber(input + 8, 2, &day)))
+    {
+        return false;
+    }
+
+    *value = QDate(year, month, day);
+    return value->isValid();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Reads the time from the "HH:mm:ss.zzz" or "HH:mm:ss" layout
+ *
+ * \param   input   Input buffer
+ * \param   size    Size of the time in the input buffer (isoTimeSize or isoTimeWithMsSize)
+ * \param   value   Output for the time value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure, input doesn't represent a valid time in the expected layout
+ */
+bool readIsoTime(const QChar *input, const int size, QTime *value)
+{
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+    int msec = 0;
+
+    if ((size != isoTimeSize) && (size != isoTimeWithMsSize))
+    {
+        return false;
+    }
+
+    if ((!readIsoNumber(input, 2, &hour)) ||
+        (input[2] != QLatin1Char(':')) ||
+        (!readIsoNumber(input + 3, 2, &minute)) ||
+        (input[5] != QLatin1Char(':')) ||
+        (!readIsoNumber(input + 6, 2, &second)))
+    {
+        return false;
+    }
+
+    if (size == isoTimeWithMsSize)
+    {
+        if ((input[8] != QLatin1Char('.')) || (!readIsoNumber(input + 9, 3, &msec)))
+        {
+            return false;
+        }
+    }
+
+    // Note: "24:00:00" is rejected here and left to Qt which treats it as the end of the day
+    *value = QTime(hour, minute, second, msec);
+    return value->isValid();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString formatIsoDate(const QDate &value)
+{
+    if (!hasIsoYear(value))
+    {
+        return value.toString(Qt::ISODate);
+    }
+
+    QChar buffer[isoDateSize];
+    writeIsoDate(buffer, value);
+    return QString(buffer, isoDateSize);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString formatIsoTime(const QTime &value)
+{
+    if (!value.isValid())
+    {
+        return value.toString(Qt::ISODateWithMs);
+    }
+
+    QChar buffer[isoTimeWithMsSize];
+    writeIsoTime(buffer, value);
+    return QString(buffer, isoTimeWithMsSize);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString formatIsoDateTime(const QDateTime &value)
+{
+    if (!value.isValid())
+    {
+        return value.toString(Qt::ISODateWithMs);
+    }
+
+    const QDate date = value.date();
+
+    if (!hasIsoYear(date))
+    {
+        return value.toString(Qt::ISODateWithMs);
+    }
+
+    QChar buffer[isoDateTimeMaxSize];
+    QChar *output = writeIsoDate(buffer, date);
+    *output++ = QLatin1Char('T');
+    output = writeIsoTime(output, value.time());
+
+    switch (value.timeSpec())
+    {
+        case Qt::LocalTime:
+        {
+            break;
+        }
+
+        case Qt::UTC:
+        {
+            *output++ = QLatin1Char('Z');
+            break;
+        }
+
+        case Qt::OffsetFromUTC:
+        case Qt::TimeZone:
+        {
+            // Same as Qt: the seconds of the offset are truncated
+            const int offset = value.offsetFromUtc();
+            const int absoluteOffset = std::abs(offset);
+            const int hours = absoluteOffset / 3600;
+
+            if (hours > 99)
+            {
+                return value.toString(Qt::ISODateWithMs);
+            }
+
+            *output++ = QLatin1Char((offset >= 0) ? '+' : '-');
+            output = writeIsoNumber(output, hours, 2);
+            *output++ = QLatin1Char(':');
+            output = writeIsoNumber(output, (absoluteOffset / 60) % 60, 2);
+            break;
+        }
+
+        default:
+        {
+            return value.toString(Qt::ISODateWithMs);
+        }
+    }
+
+    return QString(buffer, static_cast<int>(output - buffer));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QDate parseIsoDate(const QString &value)
+{
+    if (value.size() == isoDateSize)
+    {
+        QDate date;
+
+        if (readIsoDate(value.constData(), &date))
+        {
+            return date;
+        }
+    }
+
+    return QDate::fromString(value, Qt::ISODate);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QTime parseIsoTime(const QString &value)
+{
+    QTime time;
+
+    if (readIsoTime(value.constData(), value.size(), &time))
+    {
+        return time;
+    }
+
+    return QTime::fromString(value, Qt::ISODateWithMs);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QDateTime parseIsoDateTime(const QString &value)
+{
+    constexpr int timeStart = isoDateSize + 1;
+    const int size = value.size();
+
+    if ((size < (timeStart + isoTimeSize)) || (size > isoDateTimeMaxSize))
+    {
+        return QDateTime::fromString(value, Qt::ISODateWithMs);
+    }
+
+    const QChar *input = value.constData();
+
+    // Date
+    QDate date;
+
+    if ((!readIsoDate(input, &date)) || (input[isoDateSize] != QLatin1Char('T')))
+    {
+        return QDateTime::fromString(value, Qt::ISODateWithMs);
+    }
+
+    // Time
+    const int timeSize = ((size >= (timeStart + isoTimeWithMsSize)) &&
+                          (input[timeStart + isoTimeSize] == QLatin1Char('.')))
+                         ? isoTimeWithMsSize
+                         : isoTimeSize;
+    QTime time;
+
+    if (!readIsoTime(input + timeStart, timeSize, &time))
+    {
+        return QDateTime::fromString(value, Qt::ISODateWithMs);
+    }
+
+    // Time zone
+    const QChar *timeZone = input + timeStart + timeSize;
+    const int timeZoneSize = size - (timeStart + timeSize);
+
+    switch (timeZoneSize)
+    {
+        case 0:
+        {
+            return QDateTime(date, time, Qt::LocalTime);
+        }
+
+        case 1:
+        {
+            if (*timeZone == QLatin1Char('Z'))
+            {
+                return QDateTime(date, time, Qt::UTC);
+            }
+            break;
+        }
+
+        case isoOffsetSize:
+        {
+            const bool positive = (timeZone[0] == QLatin1Char('+'));
+            const bool negative = (timeZone[0] == QLatin1Char('-'));
+            int hours = 0;
+            int minutes = 0;
+
+            if ((positive || negative) &&
+                readIsoNumber(timeZone + 1, 2, &hours) &&
+                (timeZone[3] == QLatin1Char(':')) &&
+                readIsoNumber(timeZone + 4, 2, &minutes) &&
+                (hours <= 23) &&
+                (minutes <= 59))
+            {
+                const int offset = ((hours * 60) + minutes) * 60;
+                return QDateTime(date, time, Qt::OffsetFromUTC, negative ? -offset : offset);
+            }
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return QDateTime::fromString(value, Qt::ISODateWithMs);
+}
+
+} // namespace Internal
+
+} // namespace CedarFramework
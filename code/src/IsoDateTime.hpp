@@ -0,0 +1,108 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a fixed-layout ISO 8601 codec for date and time values
+ *
+ * Only the layouts produced by the serialization methods are handled directly (see below). Any
+ * other input is handed over to the Qt parsers and formatters so that the results are always
+ * identical to theirs.
+ *
+ * Handled layouts:
+ * - date: "yyyy-MM-dd"
+ * - time: "HH:mm:ss.zzz" or "HH:mm:ss"
+ * - date and time: date + "T" + time + time zone, where the time zone is either empty (local
+ *   time), "Z" (UTC) or "[+|-]HH:mm" (offset from UTC)
+ */
+
+#pragma once
+
+// Cedar Framework includes
+
+// Qt includes
+#include <QtCore/QDateTime>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+/*!
+ * Formats the date value in ISO 8601 format
+ *
+ * \param   value   Date value
+ *
+ * \return  Same string as QDate::toString(Qt::ISODate)
+ */
+QString formatIsoDate(const QDate &value);
+
+/*!
+ * Formats the time value in ISO 8601 format with millisecond precision
+ *
+ * \param   value   Time value
+ *
+ * \return  Same string as QTime::toString(Qt::ISODateWithMs)
+ */
+QString formatIsoTime(const QTime &value);
+
+/*!
+ * Formats the date and time value in ISO 8601 format with millisecond precision
+ *
+ * \param   value   Date and time value
+ *
+ * \return  Same string as QDateTime::toString(Qt::ISODateWithMs)
+ */
+QString formatIsoDateTime(const QDateTime &value);
+
+/*!
+ * Parses the date value from a string in ISO 8601 format
+ *
+ * \param   value   String value
+ *
+ * \return  Same date as QDate::fromString(value, Qt::ISODate)
+ */
+QDate parseIsoDate(const QString &value);
+
+/*!
+ * Parses the time value from a string in ISO 8601 format
+ *
+ * \param   value   String value
+ *
+ * \return  Same time as QTime::fromString(value, Qt::ISODateWithMs)
+ */
+QTime parseIsoTime(const QString &value);
+
+/*!
+ * Parses the date and time value from a string in ISO 8601 format
+ *
+ * \param   value   String value
+ *
+ * \return  Same date and time as QDateTime::fromString(value, Qt::ISODateWithMs)
+ */
+QDateTime parseIsoDateTime(const QString &value);
+
+} // namespace Internal
+
+} // namespace CedarFramework
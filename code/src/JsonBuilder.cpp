@@ -0,0 +1,81 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the builder used to construct large JSON Objects efficiently
+ */
+
+// Own header
+#include <CedarFramework/JsonBuilder.hpp>
+
+// Cedar Framework includes
+
+// Qt includes
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+JsonObjectBuilder::JsonObjectBuilder(int size)
+    : m_members()
+{
+    m_members.reserve(size);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void JsonObjectBuilder::insert(const QString &key, const QJsonValue &value)
+{
+    m_members.append(qMakePair(key, value));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject JsonObjectBuilder::toObject()
+{
+    const auto lessThan = [](const QPair<QString, QJsonValue> &left,
+                             const QPair<QString, QJsonValue> &right)
+    {
+        return left.first < right.first;
+    };
+
+    // A stable sort keeps the members with the same key in the order in which they were added so
+    // that the last one of them is the one that remains in the JSON Object
+    if (!std::is_sorted(m_members.cbegin(), m_members.cend(), lessThan))
+    {
+        std::stable_sort(m_members.begin(), m_members.end(), lessThan);
+    }
+
+    QJsonObject object;
+
+    for (const auto &member : m_members)
+    {
+        object.insert(member.first, member.second);
+    }
+
+    m_members.clear();
+    return object;
+}
+
+} // namespace CedarFramework
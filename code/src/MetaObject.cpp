@@ -0,0 +1,678 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains methods used for serialization and deserialization of the properties of Q_GADGET and
+ * QObject types
+ */
+
+// Own header
+#include <CedarFramework/MetaObject.hpp>
+
+// Cedar Framework includes
+#include <CedarFramework/Deserialization.hpp>
+#include <CedarFramework/Serialization.hpp>
+
+// Qt includes
+#include <QtCore/QBitArray>
+#include <QtCore/QDateTime>
+#include <QtCore/QHash>
+#include <QtCore/QLine>
+#include <QtCore/QLineF>
+#include <QtCore/QMetaEnum>
+#include <QtCore/QMetaProperty>
+#include <QtCore/QPoint>
+#include <QtCore/QPointF>
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QRect>
+#include <QtCore/QRectF>
+#include <QtCore/QSize>
+#include <QtCore/QSizeF>
+#include <QtCore/QUrl>
+#include <QtCore/QUuid>
+#include <QtCore/QVector>
+
+// System includes
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+//! Serialization function for a property value
+using PropertySerializer = QJsonValue (*)(const QMetaProperty &property, const QVariant &value);
+
+//! Deserialization function for a property value
+using PropertyDeserializer = bool (*)(const QJsonValue &json,
+                                      const QMetaProperty &property,
+                                      QVariant *value);
+
+//! Serialization plan of a property
+struct PropertyPlan
+{
+    //! Property
+    QMetaProperty property;
+
+    //! Member name in the JSON Object
+    QString key;
+
+    //! Serialization function for the property value
+    PropertySerializer serializer;
+
+    //! Deserialization function for the property value
+    PropertyDeserializer deserializer;
+};
+
+//! Serialization plan of a meta-object
+struct MetaObjectPlan
+{
+    //! Plans of the stored properties sorted by their keys
+    QVector<PropertyPlan> properties;
+};
+
+//! Cache of the serialization plans
+struct MetaObjectPlanCache
+{
+    //! Lock for the plans
+    QReadWriteLock lock;
+
+    //! Plans of the meta-objects (plans are never removed so they can be used without the lock)
+    QHash<const QMetaObject *, std::shared_ptr<const MetaObjectPlan>> plans;
+};
+
+// -------------------------------------------------------------------------------------------------
+// Property serializers
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes a property value
+ *
+ * \param   property    Property
+ * \param   value       Property value
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+QJsonValue serializePropertyValue(const QMetaProperty &property, const QVariant &value)
+{
+    Q_UNUSED(property);
+
+    return serialize(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes an enumeration property value with the name(s) of the value
+ *
+ * \param   property    Property
+ * \param   value       Property value
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+QJsonValue serializeEnumProperty(const QMetaProperty &property, const QVariant &value)
+{
+    const QMetaEnum metaEnum = property.enumerator();
+    const int intValue = value.toInt();
+
+    if (metaEnum.isFlag())
+    {
+        return QString::fromLatin1(metaEnum.valueToKeys(intValue));
+    }
+
+    const char *key = metaEnum.valueToKey(intValue);
+
+    if (key == nullptr)
+    {
+        qCWarning(CedarFramework::LoggingCategory::Serialization)
+                << QString("Value [%1] of the property [%2] is not a valid enumeration value")
+                   .arg(intValue)
+                   .arg(property.name());
+        return QJsonValue::Undefined;
+    }
+
+    return QString::fromLatin1(key);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes a Q_GADGET property value
+ *
+ * \param   property    Property
+ * \param   value       Property value
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+QJsonValue serializeGadgetProperty(const QMetaProperty &property, const QVariant &value)
+{
+    return serializeGadget(value.constData(), *QMetaType::metaObjectForType(property.userType()));
+}
+
+// -------------------------------------------------------------------------------------------------
+// Property deserializers
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes a property value of a type supported by the deserialize() functions
+ *
+ * \tparam  T   Property type
+ *
+ * \param       json        JSON value
+ * \param       property    Property
+ * \param[out]  value       Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T>
+bool deserializePropertyValue(const QJsonValue &json,
+                              const QMetaProperty &property,
+                              QVariant *value)
+{
+    Q_UNUSED(property);
+
+    T deserializedValue;
+
+    if (!deserialize(json, &deserializedValue))
+    {
+        return false;
+    }
+
+    *value = QVariant::fromValue(deserializedValue);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes an enumeration property value from the name(s) of the value or from a number
+ *
+ * \param       json        JSON value
+ * \param       property    Property
+ * \param[out]  value       Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+bool deserializeEnumProperty(const QJsonValue &json, const QMetaProperty &property, QVariant *value)
+{
+    if (!json.isString())
+    {
+        return deserializePropertyValue<int>(json, property, value);
+    }
+
+    const QMetaEnum metaEnum = property.enumerator();
+    const QByteArray key = json.toString().toLatin1();
+    bool ok = false;
+    const int intValue = metaEnum.isFlag() ? metaEnum.keysToValue(key.constData(), &ok)
+                                           : metaEnum.keyToValue(key.constData(), &ok);
+
+    if (!ok)
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
+                << QString("The value [%1] is not a valid value of the enumeration [%2]")
+                   .arg(json.toString())
+                   .arg(metaEnum.name());
+        return false;
+    }
+
+    *value = intValue;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes a Q_GADGET property value
+ *
+ * \param       json        JSON value
+ * \param       property    Property
+ * \param[out]  value       Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+bool deserializeGadgetProperty(const QJsonValue &json,
+                               const QMetaProperty &property,
+                               QVariant *value)
+{
+    QVariant deserializedValue(property.userType(), nullptr);
+
+    if (!deserializeGadget(json,
+                           deserializedValue.data(),
+                           *QMetaType::metaObjectForType(property.userType())))
+    {
+        return false;
+    }
+
+    *value = deserializedValue;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes a property value of any other type by converting the variant representation of the
+ * JSON value
+ *
+ * \param       json        JSON value
+ * \param       property    Property
+ * \param[out]  value       Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+bool deserializeConvertedProperty(const QJsonValue &json,
+                                  const QMetaProperty &property,
+                                  QVariant *value)
+{
+    QVariant deserializedValue = json.toVariant();
+
+    if (!deserializedValue.convert(property.userType()))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
+                << QString("JSON value can't be converted to the type [%1]:")
+                   .arg(property.typeName())
+                << json;
+        return false;
+    }
+
+    *value = deserializedValue;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Plans
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Selects the serialization function for a property
+ *
+ * \param   property    Property
+ *
+ * \return  Serialization function
+ */
+PropertySerializer selectPropertySerializer(const QMetaProperty &property)
+{
+    if (property.isEnumType())
+    {
+        return &serializeEnumProperty;
+    }
+
+    if (QMetaType::typeFlags(property.userType()).testFlag(QMetaType::IsGadget))
+    {
+        return &serializeGadgetProperty;
+    }
+
+    return &serializePropertyValue;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Selects the deserialization function for a property
+ *
+ * \param   property    Property
+ *
+ * \return  Deserialization function
+ */
+PropertyDeserializer selectPropertyDeserializer(const QMetaProperty &property)
+{
+    static const QHash<int, PropertyDeserializer> deserializers {
+        { QMetaType::Bool, &deserializePropertyValue<bool> },
+        { QMetaType::SChar, &deserializePropertyValue<signed char> },
+        { QMetaType::UChar, &deserializePropertyValue<unsigned char> },
+        { QMetaType::Short, &deserializePropertyValue<short> },
+        { QMetaType::UShort, &deserializePropertyValue<unsigned short> },
+        { QMetaType::Int, &deserializePropertyValue<int> },
+        { QMetaType::UInt, &deserializePropertyValue<unsigned int> },
+        { QMetaType::Long, &deserializePropertyValue<long> },
+        { QMetaType::ULong, &deserializePropertyValue<unsigned long> },
+        { QMetaType::LongLong, &deserializePropertyValue<long long> },
+        { QMetaType::ULongLong, &deserializePropertyValue<unsigned long long> },
+        { QMetaType::Float, &deserializePropertyValue<float> },
+        { QMetaType::Double, &deserializePropertyValue<double> },
+        { QMetaType::QChar, &deserializePropertyValue<QChar> },
+        { QMetaType::QString, &deserializePropertyValue<QString> },
+        { QMetaType::QStringList, &deserializePropertyValue<QStringList> },
+        { QMetaType::QByteArray, &deserializePropertyValue<QByteArray> },
+        { QMetaType::QBitArray, &deserializePropertyValue<QBitArray> },
+        { QMetaType::QDate, &deserializePropertyValue<QDate> },
+        { QMetaType::QTime, &deserializePropertyValue<QTime> },
+        { QMetaType::QDateTime, &deserializePropertyValue<QDateTime> },
+        { QMetaType::QUrl, &deserializePropertyValue<QUrl> },
+        { QMetaType::QUuid, &deserializePropertyValue<QUuid> },
+        { QMetaType::QSize, &deserializePropertyValue<QSize> },
+        { QMetaType::QSizeF, &deserializePropertyValue<QSizeF> },
+        { QMetaType::QPoint, &deserializePropertyValue<QPoint> },
+        { QMetaType::QPointF, &deserializePropertyValue<QPointF> },
+        { QMetaType::QLine, &deserializePropertyValue<QLine> },
+        { QMetaType::QLineF, &deserializePropertyValue<QLineF> },
+        { QMetaType::QRect, &deserializePropertyValue<QRect> },
+        { QMetaType::QRectF, &deserializePropertyValue<QRectF> },
+        { QMetaType::QVariantList, &deserializePropertyValue<QVariantList> },
+        { QMetaType::QVariantMap, &deserializePropertyValue<QVariantMap> }
+    };
+
+    if (property.isEnumType())
+    {
+        return &deserializeEnumProperty;
+    }
+
+    if (QMetaType::typeFlags(property.userType()).testFlag(QMetaType::IsGadget))
+    {
+        return &deserializeGadgetProperty;
+    }
+
+    return deserializers.value(property.userType(), &deserializeConvertedProperty);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Builds the serialization plan of a meta-object
+ *
+ * \param   metaObject  Meta-object
+ *
+ * \return  Serialization plan
+ */
+std::shared_ptr<const MetaObjectPlan> buildMetaObjectPlan(const QMetaObject &metaObject)
+{
+    auto plan = std::make_shared<MetaObjectPlan>();
+
+    // Skip the properties declared in QObject (objectName)
+    const int firstProperty = metaObject.inherits(&QObject::staticMetaObject)
+                              ? QObject::staticMetaObject.propertyCount()
+                              : 0;
+
+    for (int i = firstProperty; i < metaObject.propertyCount(); i++)
+    {
+        const QMetaProperty property = metaObject.property(i);
+
+        if ((!property.isReadable()) || (!property.isStored()))
+        {
+            continue;
+        }
+
+        plan->properties.append(PropertyPlan {
+                                    property,
+                                    QString::fromLatin1(property.name()),
+                                    selectPropertySerializer(property),
+                                    selectPropertyDeserializer(property)
+                                });
+    }
+
+    std::sort(plan->properties.begin(),
+              plan->properties.end(),
+              [](const PropertyPlan &left, const PropertyPlan &right)
+              {
+                  return left.key < right.key;
+              });
+
+    return plan;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the cached serialization plan of a meta-object, the plan is built on first use
+ *
+ * \param   metaObject  Meta-object
+ *
+ * \return  Serialization plan
+ */
+const MetaObjectPlan &metaObjectPlan(const QMetaObject &metaObject)
+{
+    static MetaObjectPlanCache cache;
+
+    {
+        QReadLocker locker(&cache.lock);
+        const auto it = cache.plans.constFind(&metaObject);
+
+        if (it != cache.plans.constEnd())
+        {
+            return *it.value();
+        }
+    }
+
+    auto plan = buildMetaObjectPlan(metaObject);
+
+    QWriteLocker locker(&cache.lock);
+    const auto it = cache.plans.constFind(&metaObject);
+
+    if (it != cache.plans.constEnd())
+    {
+        // Plan was built by another thread in the meantime
+        return *it.value();
+    }
+
+    cache.plans.insert(&metaObject, plan);
+    return *plan;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Plan execution
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes the properties with a serialization plan
+ *
+ * \tparam  ReadFunction    Type of the function for reading a property value
+ *
+ * \param   plan    Serialization plan
+ * \param   read    Function for reading a property value
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+template<typename ReadFunction>
+QJsonValue serializeProperties(const MetaObjectPlan &plan, ReadFunction read)
+{
+    QJsonObject jsonObject;
+
+    for (const PropertyPlan &propertyPlan : plan.properties)
+    {
+        const QJsonValue serializedValue =
+                propertyPlan.serializer(propertyPlan.property, read(propertyPlan.property));
+
+        if (serializedValue.isUndefined())
+        {
+            qCWarning(CedarFramework::LoggingCategory::Serialization)
+                    << QStringLiteral("Failed to serialize the property:") << propertyPlan.key;
+            return QJsonValue::Undefined;
+        }
+
+        jsonObject.insert(propertyPlan.key, serializedValue);
+    }
+
+    return jsonObject;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes the properties with a serialization plan
+ *
+ * \tparam  WriteFunction   Type of the function for writing a property value
+ *
+ * \param   json    JSON value
+ * \param   plan    Serialization plan
+ * \param   write   Function for writing a property value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    If the storage is reused (see deserializeInto()) the writable properties that are
+ *          missing in the JSON Object are reset to the default values of their types so that they
+ *          don't keep the values from the previous deserialization
+ */
+template<typename WriteFunction>
+bool deserializeProperties(const QJsonValue &json, const MetaObjectPlan &plan, WriteFunction write)
+{
+    // Get the JSON Object representation
+    if (!json.isObject())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not an Object:") << json;
+        return false;
+    }
+
+    const auto jsonObject = json.toObject();
+
+    // Merge the members of the JSON Object with the properties, both are sorted by their keys
+    const auto keyLessThan = [](const PropertyPlan &propertyPlan, const QString &key)
+    {
+        return propertyPlan.key < key;
+    };
+
+    const bool resetMissingProperties = isStorageReuseEnabled();
+    std::vector<bool> found(
+                resetMissingProperties ? static_cast<std::size_t>(plan.properties.size()) : 0,
+                false);
+    auto nextProperty = plan.properties.cbegin();
+
+    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    {
+        // The key is compared directly with the keys of the properties (Qt 5 returns it by value)
+        const QString &key = it.key();
+
+        if ((nextProperty == plan.properties.cend()) || (nextProperty->key != key))
+        {
+            nextProperty = std::lower_bound(plan.properties.cbegin(),
+                                            plan.properties.cend(),
+                                            key,
+                                            keyLessThan);
+
+            if ((nextProperty == plan.properties.cend()) || (nextProperty->key != key))
+            {
+                // Ignore unknown members
+                continue;
+            }
+        }
+
+        const PropertyPlan &propertyPlan = *nextProperty;
+
+        if (resetMissingProperties)
+        {
+            found[static_cast<std::size_t>(nextProperty - plan.properties.cbegin())] = true;
+        }
+
+        nextProperty++;
+
+        if (!propertyPlan.property.isWritable())
+        {
+            continue;
+        }
+
+        QVariant value;
+
+        if ((!propertyPlan.deserializer(it.value(), propertyPlan.property, &value)) ||
+            (!write(propertyPlan.property, value)))
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, key)
+                    << QStringLiteral("Failed to deserialize the property:") << key;
+            return false;
+        }
+    }
+
+    // Reset the missing properties
+    for (std::size_t i = 0; i < found.size(); i++)
+    {
+        const PropertyPlan &propertyPlan = plan.properties.at(static_cast<int>(i));
+
+        if (found[i] || (!propertyPlan.property.isWritable()))
+        {
+            continue;
+        }
+
+        if (!write(propertyPlan.property, QVariant(propertyPlan.property.userType(), nullptr)))
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                                 propertyPlan.key)
+                    << QStringLiteral("Failed to reset the property:") << propertyPlan.key;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonValue serializeGadget(const void *gadget, const QMetaObject &metaObject)
+{
+    Q_ASSERT(gadget != nullptr);
+
+    return Internal::serializeProperties(Internal::metaObjectPlan(metaObject),
+                                         [gadget](const QMetaProperty &property)
+                                         {
+                                             return property.readOnGadget(gadget);
+                                         });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool deserializeGadget(const QJsonValue &json, void *gadget, const QMetaObject &metaObject)
+{
+    Q_ASSERT(gadget != nullptr);
+
+    return Internal::deserializeProperties(json,
+                                           Internal::metaObjectPlan(metaObject),
+                                           [gadget](const QMetaProperty &property,
+                                                    const QVariant &value)
+                                           {
+                                               return property.writeOnGadget(gadget, value);
+                                           });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonValue serializeObject(const QObject &object)
+{
+    return Internal::serializeProperties(Internal::metaObjectPlan(*object.metaObject()),
+                                         [&object](const QMetaProperty &property)
+                                         {
+                                             return property.read(&object);
+                                         });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool deserializeObject(const QJsonValue &json, QObject *object)
+{
+    Q_ASSERT(object != nullptr);
+
+    return Internal::deserializeProperties(json,
+                                           Internal::metaObjectPlan(*object->metaObject()),
+                                           [object](const QMetaProperty &property,
+                                                    const QVariant &value)
+                                           {
+                                               return property.write(object, value);
+                                           });
+}
+
+} // namespace CedarFramework
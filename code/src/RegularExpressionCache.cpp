@@ -0,0 +1,232 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the cache of the compiled regular expressions
+ */
+
+// Own header
+#include <CedarFramework/RegularExpressionCache.hpp>
+
+// Cedar Framework includes
+
+// Qt includes
+#include <QtCore/QCache>
+#include <QtCore/QMutex>
+#include <QtCore/QPair>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+//! Default maximum number of cached regular expressions
+constexpr int defaultRegularExpressionCacheCapacity = 4096;
+
+//! Flag in the options of a cache key that marks a QRegExp
+constexpr int regExpKeyFlag = 0x40000000;
+
+//! Key of a cached regular expression: pattern and options
+using RegularExpressionKey = QPair<QString, int>;
+
+//! Cached regular expression (only the member for the type in the key is set)
+struct CachedRegularExpression
+{
+    //! QRegularExpression value
+    QRegularExpression regularExpression;
+
+    //! QRegExp value
+    QRegExp regExp;
+};
+
+//! Cache of the regular expressions
+struct RegularExpressionCache
+{
+    //! Constructor
+    RegularExpressionCache()
+    {
+        entries.setMaxCost(defaultRegularExpressionCacheCapacity);
+    }
+
+    //! Lock for the cache (a lookup also updates the order of the entries)
+    QMutex mutex;
+
+    //! Cached regular expressions in the order they were used, each one has a cost of 1
+    QCache<RegularExpressionKey, CachedRegularExpression> entries;
+
+    //! Number of lookups that found the regular expression in the cache
+    quint64 hits = 0;
+
+    //! Number of lookups that had to create the regular expression
+    quint64 misses = 0;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the process-wide cache of the regular expressions
+ *
+ * \return  Cache
+ */
+RegularExpressionCache &regularExpressionCache()
+{
+    static RegularExpressionCache cache;
+    return cache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Looks up a regular expression in the cache
+ *
+ * \param       key     Key
+ * \param[out]  entry   Output for the cached regular expression
+ *
+ * \retval  true    Regular expression was found
+ * \retval  false   Regular expression was not found
+ */
+bool findCachedRegularExpression(const RegularExpressionKey &key, CachedRegularExpression *entry)
+{
+    auto &cache = regularExpressionCache();
+    QMutexLocker locker(&cache.mutex);
+
+    const CachedRegularExpression *cachedEntry = cache.entries.object(key);
+
+    if (cachedEntry == nullptr)
+    {
+        cache.misses++;
+        return false;
+    }
+
+    cache.hits++;
+    *entry = *cachedEntry;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Adds a regular expression to the cache
+ *
+ * \param   key     Key
+ * \param   entry   Regular expression
+ */
+void addCachedRegularExpression(const RegularExpressionKey &key,
+                                const CachedRegularExpression &entry)
+{
+    auto &cache = regularExpressionCache();
+    QMutexLocker locker(&cache.mutex);
+
+    if (cache.entries.maxCost() > 0)
+    {
+        cache.entries.insert(key, new CachedRegularExpression(entry));
+    }
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+QRegularExpression cachedRegularExpression(const QString &pattern,
+                                           const QRegularExpression::PatternOptions options)
+{
+    const Internal::RegularExpressionKey key(pattern, static_cast<int>(options));
+    Internal::CachedRegularExpression entry;
+
+    if (Internal::findCachedRegularExpression(key, &entry))
+    {
+        return entry.regularExpression;
+    }
+
+    // The pattern is compiled without holding the lock so that the lookups from other threads are
+    // not blocked by it
+    entry.regularExpression = QRegularExpression(pattern, options);
+    entry.regularExpression.optimize();
+
+    Internal::addCachedRegularExpression(key, entry);
+    return entry.regularExpression;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QRegExp cachedRegExp(const QString &pattern,
+                     const Qt::CaseSensitivity caseSensitivity,
+                     const QRegExp::PatternSyntax syntax)
+{
+    const int options = Internal::regExpKeyFlag |
+                        (static_cast<int>(syntax) << 1) |
+                        static_cast<int>(caseSensitivity);
+    const Internal::RegularExpressionKey key(pattern, options);
+    Internal::CachedRegularExpression entry;
+
+    if (Internal::findCachedRegularExpression(key, &entry))
+    {
+        return entry.regExp;
+    }
+
+    entry.regExp = QRegExp(pattern, caseSensitivity, syntax);
+
+    Internal::addCachedRegularExpression(key, entry);
+    return entry.regExp;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void setRegularExpressionCacheCapacity(const int capacity)
+{
+    auto &cache = Internal::regularExpressionCache();
+    QMutexLocker locker(&cache.mutex);
+
+    cache.entries.setMaxCost(qMax(capacity, 0));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void clearRegularExpressionCache()
+{
+    auto &cache = Internal::regularExpressionCache();
+    QMutexLocker locker(&cache.mutex);
+
+    cache.entries.clear();
+    cache.hits = 0;
+    cache.misses = 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+RegularExpressionCacheStatistics regularExpressionCacheStatistics()
+{
+    auto &cache = Internal::regularExpressionCache();
+    QMutexLocker locker(&cache.mutex);
+
+    RegularExpressionCacheStatistics statistics;
+    statistics.hits = cache.hits;
+    statistics.misses = cache.misses;
+    statistics.size = cache.entries.size();
+    statistics.capacity = cache.entries.maxCost();
+    return statistics;
+}
+
+} // namespace CedarFramework
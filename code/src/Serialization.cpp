@@ -22,6 +22,11 @@
 #include <CedarFramework/Serialization.hpp>
 
 // Cedar Framework includes
+#include <CedarFramework/MetaObject.hpp>
+#include <CedarFramework/VariantConverters.hpp>
+#include "Base64.hpp"
+#include "IsoDateTime.hpp"
+#include "Transcoding.hpp"
 
 // Qt includes
 #include <QtCore/QBitArray>
@@ -61,52 +66,55 @@ namespace CedarFramework
 namespace Internal
 {
 
-template<typename T>
-using IsMax32BitInteger = std::enable_if_t<std::is_integral<T>::value && (sizeof(T) <= 4), bool>;
-
-template<typename T>
-using Is64BitInteger = std::enable_if_t<std::is_integral<T>::value && (sizeof(T) == 8), bool>;
+/*!
+ * Serializes the members of a value to a JSON Array in the order they are passed in
+ *
+ * \tparam  T   Member types
+ *
+ * \param   members Members to serialize
+ *
+ * \return  Serialized value
+ */
+template<typename... T>
+QJsonValue serializePositional(const T &...members)
+{
+    return QJsonArray { serialize(members)... };
+}
 
 // -------------------------------------------------------------------------------------------------
 
-template<typename T, IsMax32BitInteger<T> = true>
-QJsonValue convertIntegerValue(const T &value)
+/*!
+ * Decodes the UTF-8 string directly into the storage of a new string
+ *
+ * \param   value   UTF-8 string
+ *
+ * \return  Decoded string
+ */
+QString decodeUtf8(const std::string &value)
 {
-    return static_cast<qint64>(value);
+    QString result(static_cast<int>(value.size()), Qt::Uninitialized);
+    result.resize(utf8ToUtf16(value.data(), value.size(), result.data()));
+    return result;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-template<typename T, Is64BitInteger<T> = true>
-QJsonValue convertIntegerValue(const T &value)
+/*!
+ * Encodes the UTF-32 string directly into the storage of a new string
+ *
+ * \tparam  T   Code point type
+ *
+ * \param   value   UTF-32 string
+ * \param   size    Number of code points in the UTF-32 string
+ *
+ * \return  Encoded string
+ */
+template<typename T>
+QString encodeUtf32(const T *value, const std::size_t size)
 {
-    // Store the value as integer if it can be stored without loss of precision, otherwise store it
-    // as a string
-
-    // Check if input value is signed
-    if (std::is_signed<T>::value)
-    {
-        constexpr T upperLimit  = static_cast<T>( 9007199254740992LL);
-        constexpr T lowwerLimit = static_cast<T>(-9007199254740992LL);
-
-        if ((lowwerLimit <= value) && (value <= upperLimit))
-        {
-            return static_cast<qint64>(value);
-        }
-
-        return QString::number(value);
-    }
-    else
-    {
-        constexpr T limit  = static_cast<T>(9007199254740992ULL);
-
-        if (value <= limit)
-        {
-            return static_cast<qint64>(value);
-        }
-
-        return QString::number(value);
-    }
+    QString result(static_cast<int>(size * 2), Qt::Uninitialized);
+    result.resize(utf32ToUtf16(value, size, result.data()));
+    return result;
 }
 
 } // namespace Internal
@@ -172,7 +180,7 @@ QJsonValue serialize(const unsigned int &value)
 template<>
 QJsonValue serialize(const long &value)
 {
-    return Internal::convertIntegerValue(value);
+    return Internal::serializeIntegerValue(value);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -180,7 +188,7 @@ QJsonValue serialize(const long &value)
 template<>
 QJsonValue serialize(const unsigned long &value)
 {
-    return Internal::convertIntegerValue(value);
+    return Internal::serializeIntegerValue(value);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -188,7 +196,7 @@ QJsonValue serialize(const unsigned long &value)
 template<>
 QJsonValue serialize(const long long &value)
 {
-    return Internal::convertIntegerValue(value);
+    return Internal::serializeIntegerValue(value);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -196,7 +204,7 @@ QJsonValue serialize(const long long &value)
 template<>
 QJsonValue serialize(const unsigned long long &value)
 {
-    return Internal::convertIntegerValue(value);
+    return Internal::serializeIntegerValue(value);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -241,7 +249,7 @@ QJsonValue serialize(const QByteArray &value)
         return QString();
     }
 
-    return QString::fromLatin1(value.toBase64());
+    return Internal::encodeBase64(value);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -271,7 +279,7 @@ QJsonValue serialize(const QBitArray &value)
 template<>
 QJsonValue serialize(const std::string &value)
 {
-    return QString::fromStdString(value);
+    return Internal::decodeUtf8(value);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -279,7 +287,15 @@ QJsonValue serialize(const std::string &value)
 template<>
 QJsonValue serialize(const std::wstring &value)
 {
-    return QString::fromStdWString(value);
+    if (sizeof(wchar_t) == sizeof(QChar))
+    {
+        // UTF-16
+        return QString(reinterpret_cast<const QChar *>(value.data()),
+                       static_cast<int>(value.size()));
+    }
+
+    // UTF-32
+    return Internal::encodeUtf32(value.data(), value.size());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -287,7 +303,7 @@ QJsonValue serialize(const std::wstring &value)
 template<>
 QJsonValue serialize(const std::u16string &value)
 {
-    return QString::fromStdU16String(value);
+    return QString(reinterpret_cast<const QChar *>(value.data()), static_cast<int>(value.size()));
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -295,7 +311,7 @@ QJsonValue serialize(const std::u16string &value)
 template<>
 QJsonValue serialize(const std::u32string &value)
 {
-    return QString::fromStdU32String(value);
+    return Internal::encodeUtf32(value.data(), value.size());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -303,7 +319,12 @@ QJsonValue serialize(const std::u32string &value)
 template<>
 QJsonValue serialize(const QDate &value)
 {
-    return value.toString(Qt::ISODate);
+    if ((activeEncodingProfile().date == Encoding::Compact) && value.isValid())
+    {
+        return serialize(value.toJulianDay());
+    }
+
+    return Internal::formatIsoDate(value);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -311,332 +332,86 @@ QJsonValue serialize(const QDate &value)
 template<>
 QJsonValue serialize(const QTime &value)
 {
-    return value.toString(Qt::ISODateWithMs);
-}
-
-// -------------------------------------------------------------------------------------------------
+    if ((activeEncodingProfile().time == Encoding::Compact) && value.isValid())
+    {
+        return serialize(value.msecsSinceStartOfDay());
+    }
 
-template<>
-QJsonValue serialize(const QDateTime &value)
-{
-    return value.toString(Qt::ISODateWithMs);
+    return Internal::formatIsoTime(value);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<>
-QJsonValue serialize(const QVariant &value)
+QJsonValue serialize(const QDateTime &value)
 {
-    // Check for a compatible numeric type in the QVariant value
-    switch (static_cast<QMetaType::Type>(value.type()))
+    if ((activeEncodingProfile().dateTime == Encoding::Compact) && value.isValid())
     {
-        case QMetaType::Nullptr:
-        {
-            return QJsonValue::Null;
-        }
-
-        case QMetaType::Bool:
-        {
-            return serialize(value.value<bool>());
-        }
-
-        case QMetaType::SChar:
-        {
-            return serialize(value.value<signed char>());
-        }
+        const QJsonValue msecsSinceEpoch = serialize(value.toMSecsSinceEpoch());
 
-        case QMetaType::UChar:
+        if (value.timeSpec() == Qt::LocalTime)
         {
-            return serialize(value.value<unsigned char>());
+            return msecsSinceEpoch;
         }
 
-        case QMetaType::Short:
-        {
-            return serialize(value.value<short>());
-        }
-
-        case QMetaType::UShort:
-        {
-            return serialize(value.value<unsigned short>());
-        }
-
-        case QMetaType::Int:
-        {
-            return serialize(value.value<int>());
-        }
-
-        case QMetaType::UInt:
-        {
-            return serialize(value.value<unsigned int>());
-        }
-
-        case QMetaType::Long:
-        {
-            return serialize(value.value<long>());
-        }
-
-        case QMetaType::ULong:
-        {
-            return serialize(value.value<unsigned long>());
-        }
-
-        case QMetaType::LongLong:
-        {
-            return serialize(value.value<long long>());
-        }
-
-        case QMetaType::ULongLong:
-        {
-            return serialize(value.value<unsigned long long>());
-        }
-
-        case QMetaType::Float:
-        {
-            return serialize(value.value<float>());
-        }
-
-        case QMetaType::Double:
-        {
-            return serialize(value.value<double>());
-        }
-
-        case QMetaType::QTime:
-        {
-            return serialize(value.value<QTime>());
-        }
-
-        case QMetaType::QDate:
-        {
-            return serialize(value.value<QDate>());
-        }
-
-        case QMetaType::QDateTime:
-        {
-            return serialize(value.value<QDateTime>());
-        }
-
-        case QMetaType::Char:
-        {
-            return serialize(QString(QChar(value.value<char>())));
-        }
-
-        case QMetaType::QChar:
-        {
-            return serialize(QString(value.value<QChar>()));
-        }
-
-        case QMetaType::QString:
-        {
-            return serialize(value.value<QString>());
-        }
-
-        case QMetaType::QByteArray:
-        {
-            return serialize(value.value<QByteArray>());
-        }
-
-        case QMetaType::QBitArray:
-        {
-            return serialize(value.value<QBitArray>());
-        }
-
-        case QMetaType::QUrl:
-        {
-            return serialize(value.value<QUrl>());
-        }
-
-        case QMetaType::QUuid:
-        {
-            return serialize(value.value<QUuid>());
-        }
-
-        case QMetaType::QLocale:
-        {
-            return serialize(value.value<QLocale>());
-        }
-
-        case QMetaType::QRegExp:
-        {
-            return serialize(value.value<QRegExp>());
-        }
-
-        case QMetaType::QRegularExpression:
-        {
-            return serialize(value.value<QRegularExpression>());
-        }
-
-        case QMetaType::QSize:
-        {
-            return serialize(value.value<QSize>());
-        }
-
-        case QMetaType::QSizeF:
-        {
-            return serialize(value.value<QSizeF>());
-        }
-
-        case QMetaType::QPoint:
-        {
-            return serialize(value.value<QPoint>());
-        }
-
-        case QMetaType::QPointF:
-        {
-            return serialize(value.value<QPointF>());
-        }
-
-        case QMetaType::QLine:
-        {
-            return serialize(value.value<QLine>());
-        }
-
-        case QMetaType::QLineF:
-        {
-            return serialize(value.value<QLineF>());
-        }
-
-        case QMetaType::QRect:
-        {
-            return serialize(value.value<QRect>());
-        }
-
-        case QMetaType::QRectF:
-        {
-            return serialize(value.value<QRectF>());
-        }
-
-        case QMetaType::QStringList:
-        {
-            return serialize(value.value<QStringList>());
-        }
-
-        case QMetaType::QByteArrayList:
-        {
-            return serialize(value.value<QByteArrayList>());
-        }
-
-        case QMetaType::QVariantList:
-        {
-            return serialize(value.value<QVariantList>());
-        }
-
-        case QMetaType::QVariantMap:
-        {
-            return serialize(value.value<QVariantMap>());
-        }
-
-        case QMetaType::QVariantHash:
-        {
-            return serialize(value.value<QVariantHash>());
-        }
+        return QJsonArray { msecsSinceEpoch, serialize(value.offsetFromUtc()) };
+    }
 
-        case QMetaType::QJsonValue:
-        {
-            return serialize(value.value<QJsonValue>());
-        }
+    return Internal::formatIsoDateTime(value);
+}
 
-        case QMetaType::QJsonArray:
-        {
-            return serialize(value.value<QJsonArray>());
-        }
+// -------------------------------------------------------------------------------------------------
 
-        case QMetaType::QJsonObject:
-        {
-            return serialize(value.value<QJsonObject>());
-        }
+template<>
+QJsonValue serialize(const QVariant &value)
+{
+    // Use the registered converter for the type
+    const VariantSerializer serializer = Internal::variantSerializer(value.userType());
 
-        case QMetaType::QJsonDocument:
-        {
-            return serialize(value.value<QJsonDocument>());
-        }
+    if (serializer != nullptr)
+    {
+        return serializer(value);
+    }
 
-#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
-        case QMetaType::QCborValue:
-        {
-            return serialize(value.value<QCborValue>());
-        }
-#endif
+    // Check for a user type with a meta-object
+    if (value.userType() >= QMetaType::User)
+    {
+        const QMetaType::TypeFlags typeFlags = QMetaType::typeFlags(value.userType());
 
-#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
-        case QMetaType::QCborArray:
+        if (typeFlags.testFlag(QMetaType::IsGadget))
         {
-            return serialize(value.value<QCborArray>());
+            return serializeGadget(value.constData(),
+                                   *QMetaType::metaObjectForType(value.userType()));
         }
-#endif
 
-#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
-        case QMetaType::QCborMap:
+        if (typeFlags.testFlag(QMetaType::PointerToQObject))
         {
-            return serialize(value.value<QCborMap>());
-        }
-#endif
+            const QObject *object = value.value<QObject *>();
 
-#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
-        case QMetaType::QCborSimpleType:
-        {
-            return serialize(value.value<QCborSimpleType>());
-        }
-#endif
+            if (object == nullptr)
+            {
+                return QJsonValue::Null;
+            }
 
-        // Note: QVariant cannot be wrapped in another QVariant!
-        case QMetaType::QVariant:
-        {
-            qCWarning(CedarFramework::LoggingCategory::Serialization)
-                    << QStringLiteral("Cannot serialize a QVariant wrapped in another QVariant");
-            return QJsonValue::Undefined;
+            return serializeObject(*object);
         }
+    }
 
-        // TODO: add support for Qt GUI types?
-        case QMetaType::QBitmap:
-        case QMetaType::QBrush:
-        case QMetaType::QColor:
-#if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
-        case QMetaType::QColorSpace:
-#endif
-        case QMetaType::QCursor:
-        case QMetaType::QFont:
-        case QMetaType::QIcon:
-        case QMetaType::QImage:
-        case QMetaType::QKeySequence:
-        case QMetaType::QMatrix:
-        case QMetaType::QMatrix4x4:
-        case QMetaType::QPalette:
-        case QMetaType::QPixmap:
-        case QMetaType::QQuaternion:
-        case QMetaType::QRegion:
-        case QMetaType::QPen:
-        case QMetaType::QPolygon:
-        case QMetaType::QPolygonF:
-        case QMetaType::QTextFormat:
-        case QMetaType::QTextLength:
-        case QMetaType::QTransform:
-        case QMetaType::QVector2D:
-        case QMetaType::QVector3D:
-        case QMetaType::QVector4D:
-
-        // TODO: add support for Qt Widgets types?
-        case QMetaType::QSizePolicy:
-
-        // TODO: add support for handling user types?
-        case QMetaType::User:
-
-        // Note: these values cannot be serialized to JSON!
-        case QMetaType::QEasingCurve:
-        case QMetaType::QModelIndex:
-        case QMetaType::QObjectStar:
-        case QMetaType::QPersistentModelIndex:
-        case QMetaType::Void:
-        case QMetaType::VoidStar:
-        case QMetaType::UnknownType:
-        default:
-        {
-            qCWarning(CedarFramework::LoggingCategory::Serialization)
-                    << QString("Unsupported QVariant type: %1 (%2)")
-                       .arg(value.userType())
-                       .arg(value.typeName());
-            return QJsonValue::Undefined;
-        }
+    // Note: QVariant cannot be wrapped in another QVariant!
+    if (value.userType() == QMetaType::QVariant)
+    {
+        qCWarning(CedarFramework::LoggingCategory::Serialization)
+                << QStringLiteral("Cannot serialize a QVariant wrapped in another QVariant");
+        return QJsonValue::Undefined;
     }
+
+    // Note: Qt GUI and Qt Widgets types, user types without a registered converter or a
+    //       meta-object and types that cannot be represented in JSON are not supported
+    qCWarning(CedarFramework::LoggingCategory::Serialization)
+            << QString("Unsupported QVariant type: %1 (%2)")
+               .arg(value.userType())
+               .arg(value.typeName());
+    return QJsonValue::Undefined;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -652,6 +427,12 @@ QJsonValue serialize(const QUrl &value)
 template<>
 QJsonValue serialize(const QUuid &value)
 {
+    if (activeEncodingProfile().uuid == Encoding::Compact)
+    {
+        return QString::fromLatin1(value.toRfc4122().toBase64(QByteArray::Base64Encoding |
+                                                              QByteArray::OmitTrailingEquals));
+    }
+
     return value.toString();
 }
 
@@ -749,6 +530,11 @@ QJsonValue serialize(const QRegularExpression &value)
 template<>
 QJsonValue serialize(const QSize &value)
 {
+    if (activeEncodingProfile().geometry == Encoding::Compact)
+    {
+        return Internal::serializePositional(value.width(), value.height());
+    }
+
     return QJsonObject {
         { QStringLiteral("width"),  serialize(value.width()) },
         { QStringLiteral("height"), serialize(value.height()) }
@@ -760,6 +546,11 @@ QJsonValue serialize(const QSize &value)
 template<>
 QJsonValue serialize(const QSizeF &value)
 {
+    if (activeEncodingProfile().geometry == Encoding::Compact)
+    {
+        return Internal::serializePositional(value.width(), value.height());
+    }
+
     return QJsonObject {
         { QStringLiteral("width"),  serialize(value.width()) },
         { QStringLiteral("height"), serialize(value.height()) }
@@ -771,6 +562,11 @@ QJsonValue serialize(const QSizeF &value)
 template<>
 QJsonValue serialize(const QPoint &value)
 {
+    if (activeEncodingProfile().geometry == Encoding::Compact)
+    {
+        return Internal::serializePositional(value.x(), value.y());
+    }
+
     return QJsonObject {
         { QStringLiteral("x"), serialize(value.x()) },
         { QStringLiteral("y"), serialize(value.y()) }
@@ -782,6 +578,11 @@ QJsonValue serialize(const QPoint &value)
 template<>
 QJsonValue serialize(const QPointF &value)
 {
+    if (activeEncodingProfile().geometry == Encoding::Compact)
+    {
+        return Internal::serializePositional(value.x(), value.y());
+    }
+
     return QJsonObject {
         { QStringLiteral("x"), serialize(value.x()) },
         { QStringLiteral("y"), serialize(value.y()) }
@@ -793,6 +594,11 @@ QJsonValue serialize(const QPointF &value)
 template<>
 QJsonValue serialize(const QLine &value)
 {
+    if (activeEncodingProfile().geometry == Encoding::Compact)
+    {
+        return Internal::serializePositional(value.x1(), value.y1(), value.x2(), value.y2());
+    }
+
     return QJsonObject {
         { QStringLiteral("x1"), serialize(value.x1()) },
         { QStringLiteral("y1"), serialize(value.y1()) },
@@ -807,6 +613,11 @@ QJsonValue serialize(const QLine &value)
 template<>
 QJsonValue serialize(const QLineF &value)
 {
+    if (activeEncodingProfile().geometry == Encoding::Compact)
+    {
+        return Internal::serializePositional(value.x1(), value.y1(), value.x2(), value.y2());
+    }
+
     return QJsonObject {
         { QStringLiteral("x1"), serialize(value.x1()) },
         { QStringLiteral("y1"), serialize(value.y1()) },
@@ -821,6 +632,11 @@ QJsonValue serialize(const QLineF &value)
 template<>
 QJsonValue serialize(const QRect &value)
 {
+    if (activeEncodingProfile().geometry == Encoding::Compact)
+    {
+        return Internal::serializePositional(value.x(), value.y(), value.width(), value.height());
+    }
+
     return QJsonObject {
         { QStringLiteral("x"), serialize(value.x()) },
         { QStringLiteral("y"), serialize(value.y()) },
@@ -835,6 +651,11 @@ QJsonValue serialize(const QRect &value)
 template<>
 QJsonValue serialize(const QRectF &value)
 {
+    if (activeEncodingProfile().geometry == Encoding::Compact)
+    {
+        return Internal::serializePositional(value.x(), value.y(), value.width(), value.height());
+    }
+
     return QJsonObject {
         { QStringLiteral("x"), serialize(value.x()) },
         { QStringLiteral("y"), serialize(value.y()) },
@@ -956,4 +777,199 @@ QJsonValue serialize(const QCborSimpleType &value)
 }
 #endif
 
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const signed char &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return QString::number(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const unsigned char &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return QString::number(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const short &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return QString::number(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const unsigned short &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return QString::number(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const int &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return QString::number(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const unsigned int &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return QString::number(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const long &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return QString::number(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const unsigned long &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return QString::number(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const long long &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return QString::number(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const unsigned long long &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return QString::number(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const QString &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const std::string &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return Internal::decodeUtf8(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+QString serializeKey(const QUuid &value, bool *ok)
+{
+    Q_ASSERT(ok != nullptr);
+
+    *ok = true;
+    return value.toString();
+}
+
+// -------------------------------------------------------------------------------------------------
+// Explicit instantiations
+// -------------------------------------------------------------------------------------------------
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QList<int> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QList<double> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QList<QString> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QList<QVariant> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QVector<int> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QVector<double> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QVector<QString> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const std::vector<int> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const std::vector<double> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const std::vector<QString> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QMap<QString, int> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QMap<QString, double> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QMap<QString, QString> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QMap<QString, QVariant> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QHash<QString, QString> &);
+
+template
+CEDARFRAMEWORK_EXPORT QJsonValue serialize(const QHash<QString, QVariant> &);
+
 } // namespace CedarFramework
@@ -0,0 +1,569 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the transcoding between the UTF-16 storage of a string and UTF-8 or UTF-32 buffers
+ */
+
+// Own header
+#include "Transcoding.hpp"
+
+// Cedar Framework includes
+
+// Qt includes
+
+// System includes
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#endif
+
+// Forward declarations
+
+// Macros
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CEDARFRAMEWORK_TRANSCODING_SSE2
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+//! Largest Unicode code point
+constexpr uint maxCodePoint = 0x10FFFFU;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if the code unit at the position starts a valid surrogate pair
+ *
+ * \param   input       Input string
+ * \param   position    Position of the code unit
+ * \param   size        Size of the input string
+ *
+ * \retval  true    Code unit is a high surrogate followed by a low surrogate
+ * \retval  false   Code unit is not a high surrogate or it is not followed by a low surrogate
+ */
+inline bool isSurrogatePair(const ushort *input, const int position, const int size)
+{
+    return QChar::isHighSurrogate(input[position]) &&
+            ((position + 1) < size) &&
+            QChar::isLowSurrogate(input[position + 1]);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Writes the code point in UTF-16 encoding
+ *
+ * \param   codePoint   Valid code point
+ * \param   output      Output buffer
+ *
+ * \return  Position in the output buffer after the written code units
+ */
+inline ushort *writeUtf16(const uint codePoint, ushort *output)
+{
+    if (QChar::requiresSurrogates(codePoint))
+    {
+        output[0] = QChar::highSurrogate(codePoint);
+        output[1] = QChar::lowSurrogate(codePoint);
+        return output + 2;
+    }
+
+    output[0] = static_cast<ushort>(codePoint);
+    return output + 1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Decodes a single UTF-8 sequence
+ *
+ * \param       input       Input buffer positioned at the start of the sequence
+ * \param       available   Number of bytes available in the input buffer
+ * \param[out]  codePoint   Output for the decoded code point (replacement character in case the
+ *                          sequence is not valid)
+ *
+ * \return  Number of consumed bytes (only the first byte is consumed if the sequence is not valid)
+ */
+inline std::size_t decodeUtf8Sequence(const quint8 *input,
+                                      const std::size_t available,
+                                      uint *codePoint)
+{
+    const uint lead = input[0];
+    std::size_t length = 0;
+    uint minimum = 0;
+    uint value = 0;
+
+    *codePoint = QChar::ReplacementCharacter;
+
+    if (lead < 0x80U)
+    {
+        *codePoint = lead;
+        return 1;
+    }
+
+    if ((lead & 0xE0U) == 0xC0U)
+    {
+        length = 2;
+        minimum = 0x80U;
+        value = lead & 0x1FU;
+    }
+    else if ((lead & 0xF0U) == 0xE0U)
+    {
+        length = 3;
+        minimum = 0x800U;
+        value = lead & 0x0FU;
+    }
+    else if ((lead & 0xF8U) == 0xF0U)
+    {
+        length = 4;
+        minimum = 0x10000U;
+        value = lead & 0x07U;
+    }
+    else
+    {
+        return 1;
+    }
+
+    if (available < length)
+    {
+        return 1;
+    }
+
+    for (std::size_t i = 1; i < length; i++)
+    {
+        const uint continuation = input[i];
+
+        if ((continuation & 0xC0U) != 0x80U)
+        {
+            return 1;
+        }
+
+        value = (value << 6) | (continuation & 0x3FU);
+    }
+
+    // Overlong encodings, surrogates and values outside of the Unicode range are not valid
+    if ((value < minimum) || QChar::isSurrogate(value) || (value > maxCodePoint))
+    {
+        return 1;
+    }
+
+    *codePoint = value;
+    return length;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+#ifdef CEDARFRAMEWORK_TRANSCODING_SSE2
+/*!
+ * Gets a mask with all the bits set for each code unit in the block that is outside of the range
+ * selected by the mask (a code unit is in the range if it has none of the mask bits set)
+ *
+ * \param   units   Block of 8 code units
+ * \param   mask    Range mask, for example 0xFF80 for ASCII
+ *
+ * \return  Mask with all the bits set for each code unit outside of the range
+ */
+inline __m128i unitsOutsideOfRange(const __m128i units, const short mask)
+{
+    const __m128i inside = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(mask)),
+                                           _mm_setzero_si128());
+    return _mm_andnot_si128(inside, _mm_set1_epi16(-1));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if the block of 8 code units contains a surrogate
+ *
+ * \param   units   Block of 8 code units
+ *
+ * \retval  true    Block contains a surrogate
+ * \retval  false   Block doesn't contain a surrogate
+ */
+inline bool containsSurrogate(const __m128i units)
+{
+    const __m128i surrogates = _mm_cmpeq_epi16(
+                _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xF800))),
+                _mm_set1_epi16(static_cast<short>(0xD800)));
+    return _mm_movemask_epi8(surrogates) != 0;
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+std::size_t utf8Size(const QChar *input, const int size)
+{
+    const auto *units = reinterpret_cast<const ushort *>(input);
+    std::size_t result = 0;
+    int position = 0;
+
+#ifdef CEDARFRAMEWORK_TRANSCODING_SSE2
+    __m128i blockSizes = _mm_setzero_si128();
+#endif
+
+    while (position < size)
+    {
+#ifdef CEDARFRAMEWORK_TRANSCODING_SSE2
+        // Runs of characters without surrogates are measured in blocks of 8: each code unit takes
+        // 1 byte plus 1 byte if it is not ASCII plus 1 byte if it is above U+07FF
+        while ((size - position) >= 8)
+        {
+            const __m128i block = _mm_loadu_si128(
+                                      reinterpret_cast<const __m128i *>(units + position));
+
+            if (containsSurrogate(block))
+            {
+                break;
+            }
+
+            const __m128i nonAscii = unitsOutsideOfRange(block, static_cast<short>(0xFF80));
+            const __m128i aboveTwoBytes = unitsOutsideOfRange(block, static_cast<short>(0xF800));
+            const __m128i unitSizes = _mm_sub_epi16(_mm_sub_epi16(_mm_set1_epi16(1), nonAscii),
+                                                    aboveTwoBytes);
+            blockSizes = _mm_add_epi64(blockSizes, _mm_sad_epu8(unitSizes, _mm_setzero_si128()));
+            position += 8;
+        }
+
+        if (position == size)
+        {
+            break;
+        }
+#endif
+
+        const uint unit = units[position];
+
+        if (unit < 0x80U)
+        {
+            result += 1;
+        }
+        else if (unit < 0x800U)
+        {
+            result += 2;
+        }
+        else if (!QChar::isSurrogate(unit))
+        {
+            result += 3;
+        }
+        else if (isSurrogatePair(units, position, size))
+        {
+            result += 4;
+            position++;
+        }
+        else
+        {
+            // Unpaired surrogate
+            result += 1;
+        }
+
+        position++;
+    }
+
+#ifdef CEDARFRAMEWORK_TRANSCODING_SSE2
+    // Add the two horizontal sums of the block sizes
+    quint64 sums[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(sums), blockSizes);
+    result += static_cast<std::size_t>(sums[0] + sums[1]);
+#endif
+
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::size_t utf16ToUtf8(const QChar *input, const int size, char *output)
+{
+    const auto *units = reinterpret_cast<const ushort *>(input);
+    char *current = output;
+    int position = 0;
+
+    while (position < size)
+    {
+#ifdef CEDARFRAMEWORK_TRANSCODING_SSE2
+        // Runs of ASCII characters are narrowed in blocks of 8
+        while ((size - position) >= 8)
+        {
+            const __m128i block = _mm_loadu_si128(
+                                      reinterpret_cast<const __m128i *>(units + position));
+
+            if (_mm_movemask_epi8(unitsOutsideOfRange(block, static_cast<short>(0xFF80))) != 0)
+            {
+                break;
+            }
+
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(current), _mm_packus_epi16(block, block));
+            current += 8;
+            position += 8;
+        }
+
+        if (position == size)
+        {
+            break;
+        }
+#endif
+
+        const uint unit = units[position];
+
+        if (unit < 0x80U)
+        {
+            current[0] = static_cast<char>(unit);
+            current += 1;
+        }
+        else if (unit < 0x800U)
+        {
+            current[0] = static_cast<char>(0xC0U | (unit >> 6));
+            current[1] = static_cast<char>(0x80U | (unit & 0x3FU));
+            current += 2;
+        }
+        else if (!QChar::isSurrogate(unit))
+        {
+            current[0] = static_cast<char>(0xE0U | (unit >> 12));
+            current[1] = static_cast<char>(0x80U | ((unit >> 6) & 0x3FU));
+            current[2] = static_cast<char>(0x80U | (unit & 0x3FU));
+            current += 3;
+        }
+        else if (isSurrogatePair(units, position, size))
+        {
+            const uint codePoint = QChar::surrogateToUcs4(static_cast<ushort>(unit),
+                                                          units[position + 1]);
+            current[0] = static_cast<char>(0xF0U | (codePoint >> 18));
+            current[1] = static_cast<char>(0x80U | ((codePoint >> 12) & 0x3FU));
+            current[2] = static_cast<char>(0x80U | ((codePoint >> 6) & 0x3FU));
+            current[3] = static_cast<char>(0x80U | (codePoint & 0x3FU));
+            current += 4;
+            position++;
+        }
+        else
+        {
+            // Unpaired surrogate
+            current[0] = '?';
+            current += 1;
+        }
+
+        position++;
+    }
+
+    return static_cast<std::size_t>(current - output);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Decodes the UTF-16 string to UTF-32
+ *
+ * \tparam  T   Code point type
+ *
+ * \copydetails CedarFramework::Internal::utf16ToUtf32()
+ */
+template<typename T>
+std::size_t decodeUtf16(const QChar *input, const int size, T *output)
+{
+    const auto *units = reinterpret_cast<const ushort *>(input);
+    T *current = output;
+    int position = 0;
+
+    while (position < size)
+    {
+#ifdef CEDARFRAMEWORK_TRANSCODING_SSE2
+        // Runs of characters without surrogates are widened in blocks of 8
+        while ((sizeof(T) == 4) && ((size - position) >= 8))
+        {
+            const __m128i block = _mm_loadu_si128(
+                                      reinterpret_cast<const __m128i *>(units + position));
+
+            if (containsSurrogate(block))
+            {
+                break;
+            }
+
+            const __m128i zero = _mm_setzero_si128();
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(current),
+                             _mm_unpacklo_epi16(block, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(current + 4),
+                             _mm_unpackhi_epi16(block, zero));
+            current += 8;
+            position += 8;
+        }
+
+        if (position == size)
+        {
+            break;
+        }
+#endif
+
+        uint codePoint = units[position];
+
+        if (QChar::isSurrogate(codePoint))
+        {
+            if (isSurrogatePair(units, position, size))
+            {
+                codePoint = QChar::surrogateToUcs4(static_cast<ushort>(codePoint),
+                                                   units[position + 1]);
+                position++;
+            }
+            else
+            {
+                codePoint = QChar::ReplacementCharacter;
+            }
+        }
+
+        *current = static_cast<T>(codePoint);
+        current++;
+        position++;
+    }
+
+    return static_cast<std::size_t>(current - output);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::size_t utf16ToUtf32(const QChar *input, const int size, char32_t *output)
+{
+    return decodeUtf16(input, size, output);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::size_t utf16ToUtf32(const QChar *input, const int size, wchar_t *output)
+{
+    return decodeUtf16(input, size, output);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int utf8ToUtf16(const char *input, const std::size_t size, QChar *output)
+{
+    const auto *bytes = reinterpret_cast<const quint8 *>(input);
+    auto *current = reinterpret_cast<ushort *>(output);
+    std::size_t position = 0;
+
+    while (position < size)
+    {
+#ifdef CEDARFRAMEWORK_TRANSCODING_SSE2
+        // Runs of ASCII characters are widened in blocks of 16
+        while ((size - position) >= 16)
+        {
+            const __m128i block = _mm_loadu_si128(
+                                      reinterpret_cast<const __m128i *>(bytes + position));
+
+            if (_mm_movemask_epi8(block) != 0)
+            {
+                break;
+            }
+
+            const __m128i zero = _mm_setzero_si128();
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(current), _mm_unpacklo_epi8(block, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(current + 8),
+                             _mm_unpackhi_epi8(block, zero));
+            current += 16;
+            position += 16;
+        }
+
+        if (position == size)
+        {
+            break;
+        }
+#endif
+
+        uint codePoint = 0;
+        position += decodeUtf8Sequence(bytes + position, size - position, &codePoint);
+        current = writeUtf16(codePoint, current);
+    }
+
+    return static_cast<int>(current - reinterpret_cast<ushort *>(output));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Encodes the UTF-32 string to UTF-16
+ *
+ * \tparam  T   Code point type
+ *
+ * \copydetails CedarFramework::Internal::utf32ToUtf16()
+ */
+template<typename T>
+int encodeUtf16(const T *input, const std::size_t size, QChar *output)
+{
+    auto *current = reinterpret_cast<ushort *>(output);
+    std::size_t position = 0;
+
+    while (position < size)
+    {
+#ifdef CEDARFRAMEWORK_TRANSCODING_SSE2
+        // Runs of code points below the surrogates are narrowed in blocks of 4
+        while ((sizeof(T) == 4) && ((size - position) >= 4))
+        {
+            const __m128i block = _mm_loadu_si128(
+                                      reinterpret_cast<const __m128i *>(input + position));
+            const __m128i valid = _mm_and_si128(
+                                      _mm_cmplt_epi32(block, _mm_set1_epi32(0xD800)),
+                                      _mm_cmpgt_epi32(block, _mm_set1_epi32(-1)));
+
+            if (_mm_movemask_epi8(valid) != 0xFFFF)
+            {
+                break;
+            }
+
+            // Sign extend the low 16 bits so that the signed saturation keeps them unchanged
+            const __m128i extended = _mm_srai_epi32(_mm_slli_epi32(block, 16), 16);
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(current),
+                             _mm_packs_epi32(extended, extended));
+            current += 4;
+            position += 4;
+        }
+
+        if (position == size)
+        {
+            break;
+        }
+#endif
+
+        uint codePoint = static_cast<uint>(input[position]);
+
+        if ((codePoint > maxCodePoint) || QChar::isSurrogate(codePoint))
+        {
+            codePoint = QChar::ReplacementCharacter;
+        }
+
+        current = writeUtf16(codePoint, current);
+        position++;
+    }
+
+    return static_cast<int>(current - reinterpret_cast<ushort *>(output));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int utf32ToUtf16(const char32_t *input, const std::size_t size, QChar *output)
+{
+    return encodeUtf16(input, size, output);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int utf32ToUtf16(const wchar_t *input, const std::size_t size, QChar *output)
+{
+    return encodeUtf16(input, size, output);
+}
+
+} // namespace Internal
+
+} // namespace CedarFramework
@@ -0,0 +1,120 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the transcoding between the UTF-16 storage of a string and UTF-8 or UTF-32 buffers
+ *
+ * On targets with SSE2 (all x86-64 targets) the runs of ASCII characters (and for UTF-32 also the
+ * runs of characters without surrogates) are transcoded in blocks with SIMD instructions, all other
+ * characters are transcoded with a scalar codec.
+ *
+ * Error handling:
+ * - UTF-16 to UTF-8: an unpaired surrogate is encoded as '?', the same as with QString::toUtf8()
+ * - UTF-16 to UTF-32: an unpaired surrogate is decoded as the replacement character
+ * - UTF-8 to UTF-16: each byte of an invalid or incomplete sequence is decoded as the replacement
+ *   character, the same as with QString::fromUtf8()
+ * - UTF-32 to UTF-16: a surrogate or a value above U+10FFFF is encoded as the replacement
+ *   character
+ */
+
+#pragma once
+
+// Cedar Framework includes
+
+// Qt includes
+#include <QtCore/QString>
+
+// System includes
+#include <cstddef>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+/*!
+ * Calculates the size of the UTF-16 string in UTF-8 encoding
+ *
+ * \param   input   Input string
+ * \param   size    Size of the input string
+ *
+ * \return  Size of the encoded string in bytes
+ */
+std::size_t utf8Size(const QChar *input, int size);
+
+/*!
+ * Encodes the UTF-16 string to UTF-8
+ *
+ * \param       input   Input string
+ * \param       size    Size of the input string
+ * \param[out]  output  Output buffer (needs to have space for utf8Size() bytes)
+ *
+ * \return  Size of the encoded string in bytes
+ */
+std::size_t utf16ToUtf8(const QChar *input, int size, char *output);
+
+/*!
+ * Decodes the UTF-16 string to UTF-32
+ *
+ * \param       input   Input string
+ * \param       size    Size of the input string
+ * \param[out]  output  Output buffer (needs to have space for as many code points as there are
+ *                      code units in the input string)
+ *
+ * \return  Number of the decoded code points
+ */
+std::size_t utf16ToUtf32(const QChar *input, int size, char32_t *output);
+
+//! \copydoc    CedarFramework::Internal::utf16ToUtf32()
+std::size_t utf16ToUtf32(const QChar *input, int size, wchar_t *output);
+
+/*!
+ * Decodes the UTF-8 string to UTF-16
+ *
+ * \param       input   Input string
+ * \param       size    Size of the input string in bytes
+ * \param[out]  output  Output buffer (needs to have space for as many code units as there are
+ *                      bytes in the input string)
+ *
+ * \return  Number of the decoded code units
+ */
+int utf8ToUtf16(const char *input, std::size_t size, QChar *output);
+
+/*!
+ * Encodes the UTF-32 string to UTF-16
+ *
+ * \param       input   Input string
+ * \param       size    Number of code points in the input string
+ * \param[out]  output  Output buffer (needs to have space for twice as many code units as there
+ *                      are code points in the input string)
+ *
+ * \return  Number of the encoded code units
+ */
+int utf32ToUtf16(const char32_t *input, std::size_t size, QChar *output);
+
+//! \copydoc    CedarFramework::Internal::utf32ToUtf16()
+int utf32ToUtf16(const wchar_t *input, std::size_t size, QChar *output);
+
+} // namespace Internal
+
+} // namespace CedarFramework
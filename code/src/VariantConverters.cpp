@@ -0,0 +1,635 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the registry of the converters used for serialization and deserialization of QVariant
+ * values
+ */
+
+// Own header
+#include <CedarFramework/VariantConverters.hpp>
+
+// Cedar Framework includes
+
+// Qt includes
+#include <QtCore/QBitArray>
+#include <QtCore/QByteArrayList>
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+#include <QtCore/QCborArray>
+#include <QtCore/QCborMap>
+#include <QtCore/QCborValue>
+#endif
+#include <QtCore/QDateTime>
+#include <QtCore/QHash>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QLine>
+#include <QtCore/QLineF>
+#include <QtCore/QLocale>
+#include <QtCore/QPoint>
+#include <QtCore/QPointF>
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QRect>
+#include <QtCore/QRectF>
+#include <QtCore/QRegExp>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QSize>
+#include <QtCore/QSizeF>
+#include <QtCore/QUrl>
+#include <QtCore/QUuid>
+#include <QtCore/QVector>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CedarFramework
+{
+
+namespace Internal
+{
+
+//! Converter for QVariant values of a specific type
+struct VariantConverter
+{
+    //! Serialization function
+    VariantSerializer serializer = nullptr;
+
+    //! Deserialization function
+    VariantDeserializer deserializer = nullptr;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes a QVariant value holding a char
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value
+ */
+QJsonValue serializeVariantChar(const QVariant &value)
+{
+    return serialize(QString(QChar(value.value<char>())));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes a QVariant value holding a char
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+bool deserializeVariantChar(const QJsonValue &json, QVariant *value)
+{
+    QChar deserializedValue;
+
+    if (!deserialize(json, &deserializedValue))
+    {
+        return false;
+    }
+
+    *value = QVariant::fromValue(deserializedValue.toLatin1());
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes a QVariant value holding a null pointer
+ *
+ * \param   value   Value to serialize
+ *
+ * \return  Serialized value
+ */
+QJsonValue serializeVariantNullptr(const QVariant &value)
+{
+    Q_UNUSED(value);
+
+    return QJsonValue::Null;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes a QVariant value holding a null pointer
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+bool deserializeVariantNullptr(const QJsonValue &json, QVariant *value)
+{
+    if (!json.isNull())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not a Null:") << json;
+        return false;
+    }
+
+    *value = QVariant::fromValue(nullptr);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+//! Registry of the converters for QVariant values
+class VariantConverterRegistry
+{
+public:
+    //! Constructor, registers the converters for the built-in types
+    VariantConverterRegistry()
+    {
+        add(QMetaType::Nullptr, &serializeVariantNullptr, &deserializeVariantNullptr);
+        add(QMetaType::Char, &serializeVariantChar, &deserializeVariantChar);
+
+        add<bool>();
+        add<signed char>();
+        add<unsigned char>();
+        add<short>();
+        add<unsigned short>();
+        add<int>();
+        add<unsigned int>();
+        add<long>();
+        add<unsigned long>();
+        add<long long>();
+        add<unsigned long long>();
+        add<float>();
+        add<double>();
+        add<QTime>();
+        add<QDate>();
+        add<QDateTime>();
+        add<QChar>();
+        add<QString>();
+        add<QByteArray>();
+        add<QBitArray>();
+        add<QUrl>();
+        add<QUuid>();
+        add<QLocale>();
+        add<QRegExp>();
+        add<QRegularExpression>();
+        add<QSize>();
+        add<QSizeF>();
+        add<QPoint>();
+        add<QPointF>();
+        add<QLine>();
+        add<QLineF>();
+        add<QRect>();
+        add<QRectF>();
+        add<QStringList>();
+        add<QByteArrayList>();
+        add<QVariantList>();
+        add<QVariantMap>();
+        add<QVariantHash>();
+        add<QJsonValue>();
+        add<QJsonArray>();
+        add<QJsonObject>();
+        add<QJsonDocument>();
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+        add<QCborValue>();
+        add<QCborArray>();
+        add<QCborMap>();
+        add<QCborSimpleType>();
+#endif
+    }
+
+    /*!
+     * Adds a converter
+     *
+     * \param   typeId          Meta-type ID
+     * \param   serializer      Serialization function
+     * \param   deserializer    Deserialization function
+     */
+    void add(const int typeId, VariantSerializer serializer, VariantDeserializer deserializer)
+    {
+        Q_ASSERT(typeId > QMetaType::UnknownType);
+
+        QWriteLocker locker(&m_lock);
+
+        if (typeId >= m_converters.size())
+        {
+            m_converters.resize(typeId + 1);
+        }
+
+        m_converters[typeId].serializer = serializer;
+        m_converters[typeId].deserializer = deserializer;
+        m_typeIds.insert(QString::fromLatin1(QMetaType::typeName(typeId)), typeId);
+    }
+
+    /*!
+     * Gets a converter
+     *
+     * \param   typeId  Meta-type ID
+     *
+     * \return  Converter (with null functions if no converter is registered for the type)
+     */
+    VariantConverter converter(const int typeId)
+    {
+        QReadLocker locker(&m_lock);
+
+        if ((typeId <= QMetaType::UnknownType) || (typeId >= m_converters.size()))
+        {
+            return {};
+        }
+
+        return m_converters.at(typeId);
+    }
+
+    /*!
+     * Gets the meta-type ID of a type with a registered converter
+     *
+     * \param   typeName    Name of the type
+     *
+     * \return  Meta-type ID or QMetaType::UnknownType if no converter is registered for the type
+     */
+    int typeId(const QString &typeName)
+    {
+        QReadLocker locker(&m_lock);
+        return m_typeIds.value(typeName, QMetaType::UnknownType);
+    }
+
+private:
+    //! Adds a converter that uses the serialize() and deserialize() functions of the type
+    template<typename T>
+    void add()
+    {
+        add(qMetaTypeId<T>(), &serializeVariantValue<T>, &deserializeVariantValue<T>);
+    }
+
+    //! Lock for the converters
+    QReadWriteLock m_lock;
+
+    //! Converters indexed by the meta-type ID
+    QVector<VariantConverter> m_converters;
+
+    //! Meta-type IDs of the types with a registered converter by their names
+    QHash<QString, int> m_typeIds;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the registry of the converters for QVariant values
+ *
+ * \return  Registry
+ */
+VariantConverterRegistry &variantConverterRegistry()
+{
+    static VariantConverterRegistry registry;
+    return registry;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+VariantSerializer variantSerializer(const int typeId)
+{
+    return variantConverterRegistry().converter(typeId).serializer;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+VariantDeserializer variantDeserializer(const int typeId)
+{
+    return variantConverterRegistry().converter(typeId).deserializer;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes the items of a variant container together with their types
+ *
+ * \tparam  T   Container type (QVariantMap or QVariantHash)
+ *
+ * \param   value   Container to serialize
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+template<typename T>
+QJsonValue serializeTypedVariantItems(const T &value)
+{
+    QJsonObject jsonObject;
+
+    for (auto it = value.begin(); it != value.end(); it++)
+    {
+        const QJsonValue serializedItem = serializeTypedVariant(it.value());
+
+        if (serializedItem.isUndefined())
+        {
+            return QJsonValue::Undefined;
+        }
+
+        jsonObject.insert(it.key(), serializedItem);
+    }
+
+    return jsonObject;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes the items of a variant container that were serialized together with their types
+ *
+ * \tparam  T   Container type (QVariantMap or QVariantHash)
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T>
+bool deserializeTypedVariantItems(const QJsonValue &json, QVariant *value)
+{
+    if (!json.isObject())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not an Object:") << json;
+        return false;
+    }
+
+    const auto jsonObject = json.toObject();
+    T items;
+
+    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    {
+        QVariant item;
+
+        if (!deserializeTypedVariant(it.value(), &item))
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, it.key())
+                    << QStringLiteral("Failed to deserialize the typed variant with key:")
+                    << it.key();
+            return false;
+        }
+
+        items.insert(it.key(), item);
+    }
+
+    *value = items;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Serializes the items of a variant list together with their types
+ *
+ * \param   value   List to serialize
+ *
+ * \return  Serialized value or QJsonValue::Undefined in case of an error
+ */
+QJsonValue serializeTypedVariantItems(const QVariantList &value)
+{
+    QJsonArray jsonArray;
+
+    for (const QVariant &item : value)
+    {
+        const QJsonValue serializedItem = serializeTypedVariant(item);
+
+        if (serializedItem.isUndefined())
+        {
+            return QJsonValue::Undefined;
+        }
+
+        jsonArray.append(serializedItem);
+    }
+
+    return jsonArray;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Deserializes the items of a variant list that were serialized together with their types
+ *
+ * \param       json    JSON value
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+bool deserializeTypedVariantList(const QJsonValue &json, QVariant *value)
+{
+    if (!json.isArray())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not an Array:") << json;
+        return false;
+    }
+
+    const auto jsonArray = json.toArray();
+    QVariantList items;
+    items.reserve(jsonArray.size());
+
+    for (int i = 0; i < jsonArray.size(); i++)
+    {
+        QVariant item;
+
+        if (!deserializeTypedVariant(jsonArray.at(i), &item))
+        {
+            CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed, i)
+                    << QStringLiteral("Failed to deserialize the typed variant at index:") << i;
+            return false;
+        }
+
+        items.append(item);
+    }
+
+    *value = items;
+    return true;
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+void registerVariantConverter(const int typeId,
+                              VariantSerializer serializer,
+                              VariantDeserializer deserializer)
+{
+    Q_ASSERT(serializer != nullptr);
+    Q_ASSERT(deserializer != nullptr);
+
+    Internal::variantConverterRegistry().add(typeId, serializer, deserializer);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool hasVariantConverter(const int typeId)
+{
+    return (Internal::variantSerializer(typeId) != nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonValue serializeTypedVariant(const QVariant &value)
+{
+    if (!value.isValid())
+    {
+        return QJsonValue::Null;
+    }
+
+    // Items of the variant containers are also serialized together with their types
+    QJsonValue serializedValue;
+
+    switch (value.userType())
+    {
+        case QMetaType::QVariantList:
+        {
+            serializedValue = Internal::serializeTypedVariantItems(value.value<QVariantList>());
+            break;
+        }
+
+        case QMetaType::QVariantMap:
+        {
+            serializedValue = Internal::serializeTypedVariantItems(value.value<QVariantMap>());
+            break;
+        }
+
+        case QMetaType::QVariantHash:
+        {
+            serializedValue = Internal::serializeTypedVariantItems(value.value<QVariantHash>());
+            break;
+        }
+
+        default:
+        {
+            serializedValue = serialize(value);
+            break;
+        }
+    }
+
+    if (serializedValue.isUndefined())
+    {
+        return QJsonValue::Undefined;
+    }
+
+    return QJsonObject {
+        { QStringLiteral("type"), QString::fromLatin1(value.typeName()) },
+        { QStringLiteral("value"), serializedValue }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool deserializeTypedVariant(const QJsonValue &json, QVariant *value)
+{
+    Q_ASSERT(value != nullptr);
+
+    if (json.isNull())
+    {
+        *value = QVariant();
+        return true;
+    }
+
+    if (!json.isObject())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidType)
+                << QStringLiteral("JSON value is not a valid typed variant:") << json;
+        return false;
+    }
+
+    const auto jsonObject = json.toObject();
+
+    if (jsonObject.size() != 2)
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidSize)
+                << QString("A typed variant needs to have exactly 2 members but this one has %1! "
+                           "JSON value:").arg(jsonObject.size())
+                << jsonObject;
+        return false;
+    }
+
+    // Find the converter for the type
+    const QJsonValue typeName = jsonObject.value(QStringLiteral("type"));
+
+    if (!typeName.isString())
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("type"))
+                << QStringLiteral("Typed variant doesn't contain a valid type name:") << jsonObject;
+        return false;
+    }
+
+    // The types with a registered converter are looked up by their name in the registry, only the
+    // other names (for example typedefs) need the slower lookup in the meta-type system
+    int typeId = Internal::variantConverterRegistry().typeId(typeName.toString());
+
+    if (typeId == QMetaType::UnknownType)
+    {
+        typeId = QMetaType::type(typeName.toString().toLatin1().constData());
+    }
+
+    VariantDeserializer deserializer = nullptr;
+
+    switch (typeId)
+    {
+        case QMetaType::QVariantList:
+        {
+            deserializer = &Internal::deserializeTypedVariantList;
+            break;
+        }
+
+        case QMetaType::QVariantMap:
+        {
+            deserializer = &Internal::deserializeTypedVariantItems<QVariantMap>;
+            break;
+        }
+
+        case QMetaType::QVariantHash:
+        {
+            deserializer = &Internal::deserializeTypedVariantItems<QVariantHash>;
+            break;
+        }
+
+        default:
+        {
+            deserializer = Internal::variantDeserializer(typeId);
+            break;
+        }
+    }
+
+    if (deserializer == nullptr)
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::InvalidValue)
+                << QString("No converter is registered for the type [%1]")
+                   .arg(typeName.toString());
+        return false;
+    }
+
+    // Deserialize the value
+    if (!deserializer(jsonObject.value(QStringLiteral("value")), value))
+    {
+        CEDARFRAMEWORK_DESERIALIZATION_ERROR(DeserializationErrorCode::ItemFailed,
+                                             QStringLiteral("value"))
+                << QString("Failed to deserialize the value of the type [%1]")
+                   .arg(typeName.toString());
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace CedarFramework
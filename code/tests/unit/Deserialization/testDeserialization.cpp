@@ -42,6 +42,86 @@
 
 // Test class declaration --------------------------------------------------------------------------
 
+template<typename C>
+QVector<int> toVector(const C &container)
+{
+    QVector<int> vector;
+
+    for (const int item : container)
+    {
+        vector.append(item);
+    }
+
+    return vector;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject createLargeObject()
+{
+    // Keys are zero-padded so that their order is the same as a string and as a number
+    QVariantMap map;
+
+    for (int i = 0; i < 1000000; i++)
+    {
+        map.insert(QString("%1").arg(i, 7, 10, QChar('0')), i);
+    }
+
+    return QJsonObject::fromVariantMap(map);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonArray createNestedArray()
+{
+    QJsonArray array;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        QJsonArray items;
+
+        for (int j = 0; j < 100; j++)
+        {
+            items.append(i * 100 + j);
+        }
+
+        array.append(items);
+    }
+
+    return array;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonArray createDeeplyNestedArray()
+{
+    // Strings are long enough that they are not stored inline in std::string
+    QJsonArray array;
+
+    for (int i = 0; i < 200; i++)
+    {
+        QJsonObject object;
+
+        for (int j = 0; j < 10; j++)
+        {
+            QJsonArray items;
+
+            for (int k = 0; k < 10; k++)
+            {
+                items.append(QString("nested-item-value-%1-%2-%3").arg(i).arg(j).arg(k));
+            }
+
+            object.insert(QString("nested-item-key-%1").arg(j), items);
+        }
+
+        array.append(object);
+    }
+
+    return array;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename T>
 using IsMax32BitInteger = std::enable_if_t<std::is_integral<T>::value && (sizeof(T) <= 4), bool>;
 
@@ -121,6 +201,9 @@ void createIntegerTestData()
                 << static_cast<T>(0)
                 << false;
 
+        QTest::newRow("String: leading zeros") << QJsonValue("007") << static_cast<T>(7) << true;
+        QTest::newRow("String: exponent") << QJsonValue("1e1") << static_cast<T>(10) << true;
+        QTest::newRow("String: empty") << QJsonValue("") << static_cast<T>(0) << false;
         QTest::newRow("String: invalid") << QJsonValue("abc") << static_cast<T>(0) << false;
 
         QTest::newRow("Array") << QJsonValue(QJsonArray()) << static_cast<T>(0) << false;
@@ -169,6 +252,9 @@ void createIntegerTestData()
                 << static_cast<T>(0)
                 << false;
 
+        QTest::newRow("String: leading zeros") << QJsonValue("007") << static_cast<T>(7) << true;
+        QTest::newRow("String: exponent") << QJsonValue("1e1") << static_cast<T>(10) << true;
+        QTest::newRow("String: empty") << QJsonValue("") << static_cast<T>(0) << false;
         QTest::newRow("String: invalid") << QJsonValue("abc") << static_cast<T>(0) << false;
 
         QTest::newRow("Array") << QJsonValue(QJsonArray()) << static_cast<T>(0) << false;
@@ -252,6 +338,9 @@ void createIntegerTestData()
                 << static_cast<T>(0)
                 << false;
 
+        QTest::newRow("String: leading zeros") << QJsonValue("007") << static_cast<T>(7) << true;
+        QTest::newRow("String: exponent") << QJsonValue("1e1") << static_cast<T>(10) << true;
+        QTest::newRow("String: empty") << QJsonValue("") << static_cast<T>(0) << false;
         QTest::newRow("String: invalid") << QJsonValue("abc") << static_cast<T>(0) << false;
 
         QTest::newRow("Array") << QJsonValue(QJsonArray()) << static_cast<T>(0) << false;
@@ -300,6 +389,9 @@ void createIntegerTestData()
         QTest::newRow("String (from int): -1")
                 << QJsonValue("-1") << static_cast<T>(0) << false;
 
+        QTest::newRow("String: leading zeros") << QJsonValue("007") << static_cast<T>(7) << true;
+        QTest::newRow("String: exponent") << QJsonValue("1e1") << static_cast<T>(10) << true;
+        QTest::newRow("String: empty") << QJsonValue("") << static_cast<T>(0) << false;
         QTest::newRow("String: invalid") << QJsonValue("abc") << static_cast<T>(0) << false;
 
         QTest::newRow("Array") << QJsonValue(QJsonArray()) << static_cast<T>(0) << false;
@@ -370,6 +462,8 @@ private slots:
 
     void testDeserializeQByteArray();
     void testDeserializeQByteArray_data();
+    void testDeserializeQByteArrayScalarCode();
+    void testDeserializeQByteArrayScalarCode_data();
 
     void testDeserializeQBitArray();
     void testDeserializeQBitArray_data();
@@ -389,21 +483,36 @@ private slots:
     void testDeserializeQDate();
     void testDeserializeQDate_data();
 
+    void testDeserializeQDateCompact();
+    void testDeserializeQDateCompact_data();
+
     void testDeserializeQTime();
     void testDeserializeQTime_data();
 
+    void testDeserializeQTimeCompact();
+    void testDeserializeQTimeCompact_data();
+
     void testDeserializeQDateTime();
     void testDeserializeQDateTime_data();
 
+    void testDeserializeQDateTimeCompact();
+    void testDeserializeQDateTimeCompact_data();
+
     void testDeserializeQVariant();
     void testDeserializeQVariant_data();
 
+    void testDeserializeQVariantExistingValue();
+    void testDeserializeQVariantExistingValue_data();
+
     void testDeserializeQUrl();
     void testDeserializeQUrl_data();
 
     void testDeserializeQUuid();
     void testDeserializeQUuid_data();
 
+    void testDeserializeQUuidCompact();
+    void testDeserializeQUuidCompact_data();
+
     void testDeserializeQLocale();
     void testDeserializeQLocale_data();
 
@@ -434,6 +543,9 @@ private slots:
     void testDeserializeQRect();
     void testDeserializeQRect_data();
 
+    void testDeserializeQRectCompact();
+    void testDeserializeQRectCompact_data();
+
     void testDeserializeQRectF();
     void testDeserializeQRectF_data();
 
@@ -478,6 +590,9 @@ private slots:
     void testDeserializeStdPair();
     void testDeserializeStdPair_data();
 
+    void testDeserializeStdPairCompact();
+    void testDeserializeStdPairCompact_data();
+
     void testDeserializeQList();
     void testDeserializeQList_data();
 
@@ -493,6 +608,21 @@ private slots:
     void testDeserializeQSet();
     void testDeserializeQSet_data();
 
+    void testDeserializeQVarLengthArray();
+    void testDeserializeQVarLengthArray_data();
+
+    void testDeserializeStdDeque();
+    void testDeserializeStdDeque_data();
+
+    void testDeserializeStdArray();
+    void testDeserializeStdArray_data();
+
+    void testDeserializeStdSet();
+    void testDeserializeStdSet_data();
+
+    void testDeserializeStdUnorderedSet();
+    void testDeserializeStdUnorderedSet_data();
+
     void testDeserializeQMap();
     void testDeserializeQMap_data();
 
@@ -534,6 +664,43 @@ private slots:
 
     void testDeserializeOptionalNodeByPathStringList();
     void testDeserializeOptionalNodeByPathStringList_data();
+
+    void testDeserializationErrorCollector();
+    void testDeserializationErrorCollector_data();
+
+    void testDeserializationErrorCollectorMultipleErrors();
+
+    void testDeserializationErrorNodePath();
+
+    void testInlineOverloads();
+    void testInlineOverloads_data();
+
+    void testDeserializeInto();
+
+#ifdef CEDARFRAMEWORK_HAS_STD_PMR
+    void testDeserializePmrContainers();
+#endif
+
+    // Benchmarks
+    void benchmarkDeserializeStdVectorInt();
+    void benchmarkDeserializeQVectorDouble();
+    void benchmarkDeserializeQSetInt();
+    void benchmarkDeserializeQMap();
+    void benchmarkDeserializeStdMap();
+    void benchmarkDeserializeQHash();
+    void benchmarkDeserializeStdUnorderedMap();
+    void benchmarkDeserializeQMultiMap();
+    void benchmarkDeserializeQByteArray();
+    void benchmarkDeserializeQByteArray_data();
+    void benchmarkDeserializeStdString();
+    void benchmarkDeserializeNestedVector();
+    void benchmarkDeserializeIntoNestedVector();
+    void benchmarkDeserializeDeeplyNestedDefaultAllocator();
+#ifdef CEDARFRAMEWORK_HAS_STD_PMR
+    void benchmarkDeserializeDeeplyNestedPmrAllocator();
+#endif
+    void benchmarkDeserializeInstantiatedContainers();
+    void benchmarkDeserializeInstantiatedContainers_data();
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -928,6 +1095,7 @@ void TestDeserialization::testDeserializeFloat_data()
     QTest::newRow("String: -1.0") << QJsonValue("-1.0") << -1.0F << true;
     QTest::newRow("String:  0.0") << QJsonValue("0.0") << 0.0F << true;
     QTest::newRow("String: +1.0") << QJsonValue("1.0") << 1.0F << true;
+    QTest::newRow("String: integer") << QJsonValue("-42") << -42.0F << true;
     QTest::newRow("String: max")
             << QJsonValue(QString::number(std::numeric_limits<float>::max(), 0, 'f'))
             << std::numeric_limits<float>::max()
@@ -1002,6 +1170,7 @@ void TestDeserialization::testDeserializeDouble_data()
     QTest::newRow("String: -1.0") << QJsonValue("-1.0") << -1.0 << true;
     QTest::newRow("String:  0.0") << QJsonValue("0.0") << 0.0 << true;
     QTest::newRow("String: +1.0") << QJsonValue("1.0") << 1.0 << true;
+    QTest::newRow("String: integer") << QJsonValue("-42") << -42.0 << true;
     QTest::newRow("String: max")
             << QJsonValue(QString::number(std::numeric_limits<double>::max(), 0, 'f'))
             << std::numeric_limits<double>::max()
@@ -1133,6 +1302,17 @@ void TestDeserialization::testDeserializeQByteArray_data()
     QTest::newRow("String: empty") << QJsonValue(QString()) << QByteArray() << true;
     QTest::newRow("String: a z A Z 0 9 + - ?")
             << QJsonValue("YSB6IEEgWiAwIDkgKyAtID8=") << QByteArray("a z A Z 0 9 + - ?") << true;
+    QTest::newRow("String: no padding") << QJsonValue("YWI") << QByteArray("ab") << true;
+
+    QByteArray bytes;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        bytes.append(static_cast<char>(i * 7));
+    }
+
+    QTest::newRow("String: 1000 bytes")
+            << QJsonValue(QString::fromLatin1(bytes.toBase64())) << bytes << true;
 
     // Negative tests
     QTest::newRow("Null") << QJsonValue() << QByteArray() << false;
@@ -1142,14 +1322,73 @@ void TestDeserialization::testDeserializeQByteArray_data()
 
     QTest::newRow("Double: 1.0") << QJsonValue(1.0) << QByteArray() << false;
 
-#if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
     QTest::newRow("String: invalid") << QJsonValue("xyz&!") << QByteArray() << false;
-#endif
+    QTest::newRow("String: invalid size") << QJsonValue("YWJjZ") << QByteArray() << false;
+    QTest::newRow("String: invalid padding") << QJsonValue("YQ=") << QByteArray() << false;
+    QTest::newRow("String: padding only") << QJsonValue("====") << QByteArray() << false;
+
+    QTest::newRow("String: non-Latin-1 character")
+            << QJsonValue(QString("YW") + QChar(0x0159) + QString("j"))
+            << QByteArray()
+            << false;
+
+    QTest::newRow("String: invalid character in a long string")
+            << QJsonValue(QString(20, QChar('A')) + QChar('&') + QString(11, QChar('A')))
+            << QByteArray()
+            << false;
 
     QTest::newRow("Array") << QJsonValue(QJsonArray()) << QByteArray() << false;
     QTest::newRow("Object") << QJsonValue(QJsonObject()) << QByteArray() << false;
 }
 
+// Test: deserialize<QByteArray>() method with the scalar codec ------------------------------------
+
+void TestDeserialization::testDeserializeQByteArrayScalarCode()
+{
+    QFETCH(int, size);
+
+    QByteArray expectedOutput;
+
+    for (int i = 0; i < size; i++)
+    {
+        expectedOutput.append(static_cast<char>(i * 37 + 11));
+    }
+
+    const QString encoded = QString::fromLatin1(expectedOutput.toBase64());
+
+    const auto checkCodec = [&]()
+    {
+        QByteArray output;
+        QVERIFY(CedarFramework::deserialize(QJsonValue(encoded), &output));
+        QCOMPARE(output, expectedOutput);
+
+        // An invalid character must be rejected at any position
+        for (int i = 0; i < encoded.size(); i++)
+        {
+            QString invalid = encoded;
+            invalid[i] = QChar('&');
+
+            QVERIFY(!CedarFramework::deserialize(QJsonValue(invalid), &output));
+        }
+    };
+
+    checkCodec();
+
+    CedarFramework::Internal::ScalarCodeScope scalarCodeScope;
+    checkCodec();
+}
+
+void TestDeserialization::testDeserializeQByteArrayScalarCode_data()
+{
+    QTest::addColumn<int>("size");
+
+    // Sizes around the 16 character blocks of the SIMD codec
+    for (int size : {0, 1, 11, 12, 13, 15, 16, 17, 23, 24, 25, 31, 32, 33, 47, 48, 49, 1000})
+    {
+        QTest::addRow("%d bytes", size) << size;
+    }
+}
+
 // Test: deserialize<QBitArray>() method -----------------------------------------------------------
 
 void TestDeserialization::testDeserializeQBitArray()
@@ -1269,6 +1508,10 @@ void TestDeserialization::testDeserializeStdString_data()
     QTest::newRow("String: empty") << QJsonValue(QString()) << std::string() << true;
     QTest::newRow("String: a z A Z 0 9 + - ?")
             << QJsonValue("a z A Z 0 9 + - ?") << std::string("a z A Z 0 9 + - ?") << true;
+    QTest::newRow("String: non-ASCII")
+            << QJsonValue(QString::fromUtf8(u8"\u00e9 \u20ac \U0001F600"))
+            << std::string(u8"\u00e9 \u20ac \U0001F600")
+            << true;
 
     // Negative tests
     QTest::newRow("Null") << QJsonValue() << std::string() << false;
@@ -1312,6 +1555,10 @@ void TestDeserialization::testDeserializeStdWString_data()
     QTest::newRow("String: empty") << QJsonValue(QString()) << std::wstring() << true;
     QTest::newRow("String: a z A Z 0 9 + - ?")
             << QJsonValue("a z A Z 0 9 + - ?") << std::wstring(L"a z A Z 0 9 + - ?") << true;
+    QTest::newRow("String: non-ASCII")
+            << QJsonValue(QString::fromUtf8(u8"\u00e9 \u20ac \U0001F600"))
+            << std::wstring(L"\u00e9 \u20ac \U0001F600")
+            << true;
 
     // Negative tests
     QTest::newRow("Null") << QJsonValue() << std::wstring() << false;
@@ -1355,6 +1602,10 @@ void TestDeserialization::testDeserializeStdU16String_data()
     QTest::newRow("String: empty") << QJsonValue(QString()) << std::u16string() << true;
     QTest::newRow("String: a z A Z 0 9 + - ?")
             << QJsonValue("a z A Z 0 9 + - ?") << std::u16string(u"a z A Z 0 9 + - ?") << true;
+    QTest::newRow("String: non-ASCII")
+            << QJsonValue(QString::fromUtf8(u8"\u00e9 \u20ac \U0001F600"))
+            << std::u16string(u"\u00e9 \u20ac \U0001F600")
+            << true;
 
     // Negative tests
     QTest::newRow("Null") << QJsonValue() << std::u16string() << false;
@@ -1398,6 +1649,10 @@ void TestDeserialization::testDeserializeStdU32String_data()
     QTest::newRow("String: empty") << QJsonValue(QString()) << std::u32string() << true;
     QTest::newRow("String: a z A Z 0 9 + - ?")
             << QJsonValue("a z A Z 0 9 + - ?") << std::u32string(U"a z A Z 0 9 + - ?") << true;
+    QTest::newRow("String: non-ASCII")
+            << QJsonValue(QString::fromUtf8(u8"\u00e9 \u20ac \U0001F600"))
+            << std::u32string(U"\u00e9 \u20ac \U0001F600")
+            << true;
 
     // Negative tests
     QTest::newRow("Null") << QJsonValue() << std::u32string() << false;
@@ -1454,6 +1709,42 @@ void TestDeserialization::testDeserializeQDate_data()
     QTest::newRow("Object") << QJsonValue(QJsonObject()) << QDate() << false;
 }
 
+// Test: deserialize<QDate>() method with compact encoding -----------------------------------------
+
+void TestDeserialization::testDeserializeQDateCompact()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(QDate, expectedOutput);
+    QFETCH(bool, expectedResult);
+
+    QDate output;
+    const bool result = CedarFramework::deserialize(
+                            input, &output, CedarFramework::EncodingProfile::compact());
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(output, expectedOutput);
+    }
+}
+
+void TestDeserialization::testDeserializeQDateCompact_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<QDate>("expectedOutput");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("Double: 2459067") << QJsonValue(2459067) << QDate(2020, 8, 5) << true;
+    QTest::newRow("String: empty") << QJsonValue(QString()) << QDate() << true;
+    QTest::newRow("String: 2020-08-05") << QJsonValue("2020-08-05") << QDate(2020, 8, 5) << true;
+
+    // Negative tests
+    QTest::newRow("Null") << QJsonValue() << QDate() << false;
+    QTest::newRow("Double: 1e20") << QJsonValue(1e20) << QDate() << false;
+    QTest::newRow("Array") << QJsonValue(QJsonArray()) << QDate() << false;
+}
+
 // Test: deserialize<QTime>() method ---------------------------------------------------------------
 
 void TestDeserialization::testDeserializeQTime()
@@ -1482,6 +1773,7 @@ void TestDeserialization::testDeserializeQTime_data()
     QTest::newRow("String: empty") << QJsonValue(QString()) << QTime() << true;
     QTest::newRow("String: 12:34:56.789")
             << QJsonValue("12:34:56.789") << QTime(12, 34, 56, 789) << true;
+    QTest::newRow("String: 12:34:56") << QJsonValue("12:34:56") << QTime(12, 34, 56) << true;
 
     // Negative tests
     QTest::newRow("Null") << QJsonValue() << QTime() << false;
@@ -1498,6 +1790,44 @@ void TestDeserialization::testDeserializeQTime_data()
     QTest::newRow("Object") << QJsonValue(QJsonObject()) << QTime() << false;
 }
 
+// Test: deserialize<QTime>() method with compact encoding -----------------------------------------
+
+void TestDeserialization::testDeserializeQTimeCompact()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(QTime, expectedOutput);
+    QFETCH(bool, expectedResult);
+
+    QTime output;
+    const bool result = CedarFramework::deserialize(
+                            input, &output, CedarFramework::EncodingProfile::compact());
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(output, expectedOutput);
+    }
+}
+
+void TestDeserialization::testDeserializeQTimeCompact_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<QTime>("expectedOutput");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("Double: 0") << QJsonValue(0) << QTime(0, 0) << true;
+    QTest::newRow("Double: 45296789")
+            << QJsonValue(45296789) << QTime(12, 34, 56, 789) << true;
+    QTest::newRow("String: 12:34:56.789")
+            << QJsonValue("12:34:56.789") << QTime(12, 34, 56, 789) << true;
+
+    // Negative tests
+    QTest::newRow("Double: -1") << QJsonValue(-1) << QTime() << false;
+    QTest::newRow("Double: 86400000") << QJsonValue(86400000) << QTime() << false;
+    QTest::newRow("Array") << QJsonValue(QJsonArray()) << QTime() << false;
+}
+
 // Test: deserialize<QDateTime>() method -----------------------------------------------------------
 
 void TestDeserialization::testDeserializeQDateTime()
@@ -1528,6 +1858,18 @@ void TestDeserialization::testDeserializeQDateTime_data()
             << QJsonValue("2020-08-05T12:34:56.789Z")
             << QDateTime(QDate(2020, 8, 5), QTime(12, 34, 56, 789), Qt::UTC)
             << true;
+    QTest::newRow("String: 2020-08-05T12:34:56.789")
+            << QJsonValue("2020-08-05T12:34:56.789")
+            << QDateTime(QDate(2020, 8, 5), QTime(12, 34, 56, 789), Qt::LocalTime)
+            << true;
+    QTest::newRow("String: 2020-08-05T12:34:56.789+05:30")
+            << QJsonValue("2020-08-05T12:34:56.789+05:30")
+            << QDateTime(QDate(2020, 8, 5), QTime(12, 34, 56, 789), Qt::OffsetFromUTC, 19800)
+            << true;
+    QTest::newRow("String: 2020-08-05T12:34:56Z")
+            << QJsonValue("2020-08-05T12:34:56Z")
+            << QDateTime(QDate(2020, 8, 5), QTime(12, 34, 56), Qt::UTC)
+            << true;
 
     // Negative tests
     QTest::newRow("Null") << QJsonValue() << QDateTime() << false;
@@ -1540,11 +1882,63 @@ void TestDeserialization::testDeserializeQDateTime_data()
     QTest::newRow("String: invalid 1") << QJsonValue(QString("asd")) << QDateTime() << false;
     QTest::newRow("String: invalid 2")
             << QJsonValue("2020138-05T12:34:56.789Z") << QDateTime() << false;
+    QTest::newRow("String: invalid 3")
+            << QJsonValue("2020-02-30T12:34:56.789Z") << QDateTime() << false;
 
     QTest::newRow("Array") << QJsonValue(QJsonArray()) << QDateTime() << false;
     QTest::newRow("Object") << QJsonValue(QJsonObject()) << QDateTime() << false;
 }
 
+// Test: deserialize<QDateTime>() method with compact encoding -------------------------------------
+
+void TestDeserialization::testDeserializeQDateTimeCompact()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(QDateTime, expectedOutput);
+    QFETCH(bool, expectedResult);
+
+    QDateTime output;
+    const bool result = CedarFramework::deserialize(
+                            input, &output, CedarFramework::EncodingProfile::compact());
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(output, expectedOutput);
+    }
+}
+
+void TestDeserialization::testDeserializeQDateTimeCompact_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<QDateTime>("expectedOutput");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("Double: local time")
+            << QJsonValue(1596630896789.0)
+            << QDateTime::fromMSecsSinceEpoch(1596630896789LL)
+            << true;
+    QTest::newRow("Array: UTC")
+            << QJsonValue(QJsonArray { 1596630896789.0, 0 })
+            << QDateTime(QDate(2020, 8, 5), QTime(12, 34, 56, 789), Qt::UTC)
+            << true;
+    QTest::newRow("Array: offset from UTC")
+            << QJsonValue(QJsonArray { 1596630896789.0, 7200 })
+            << QDateTime(QDate(2020, 8, 5), QTime(14, 34, 56, 789), Qt::OffsetFromUTC, 7200)
+            << true;
+    QTest::newRow("String: 2020-08-05T12:34:56.789Z")
+            << QJsonValue("2020-08-05T12:34:56.789Z")
+            << QDateTime(QDate(2020, 8, 5), QTime(12, 34, 56, 789), Qt::UTC)
+            << true;
+
+    // Negative tests
+    QTest::newRow("Array: empty") << QJsonValue(QJsonArray()) << QDateTime() << false;
+    QTest::newRow("Array: invalid offset")
+            << QJsonValue(QJsonArray { 1596630896789.0, "a" }) << QDateTime() << false;
+    QTest::newRow("Object") << QJsonValue(QJsonObject()) << QDateTime() << false;
+}
+
 // Test: deserialize<QVariant>() method ------------------------------------------------------------
 
 void TestDeserialization::testDeserializeQVariant()
@@ -1594,6 +1988,41 @@ void TestDeserialization::testDeserializeQVariant_data()
             << true;
 }
 
+// Test: deserialize<QVariant>() method with an existing value -------------------------------------
+
+void TestDeserialization::testDeserializeQVariantExistingValue()
+{
+    QFETCH(QVariant, existingValue);
+    QFETCH(QJsonValue, input);
+    QFETCH(QVariant, expectedOutput);
+
+    // The type of the existing value doesn't affect the deserialized value
+    QVariant output = existingValue;
+    QVERIFY(CedarFramework::deserialize(input, &output));
+    QCOMPARE(output.userType(), expectedOutput.userType());
+    QCOMPARE(output, expectedOutput);
+}
+
+void TestDeserialization::testDeserializeQVariantExistingValue_data()
+{
+    QTest::addColumn<QVariant>("existingValue");
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<QVariant>("expectedOutput");
+
+    QTest::newRow("Int: string") << QVariant(5) << QJsonValue("x") << QVariant(QString("x"));
+    QTest::newRow("Int: double") << QVariant(5) << QJsonValue(2.5) << QVariant(2.5);
+
+    QTest::newRow("String: array")
+            << QVariant(QString("a"))
+            << QJsonValue(QJsonArray({ 1, 2 }))
+            << QVariant(QVariantList({ 1, 2 }));
+
+    QTest::newRow("Date: string")
+            << QVariant(QDate(2020, 1, 2))
+            << QJsonValue("2020-01-03")
+            << QVariant(QString("2020-01-03"));
+}
+
 // Test: deserialize<QUrl>() method ----------------------------------------------------------------
 
 void TestDeserialization::testDeserializeQUrl()
@@ -1688,6 +2117,47 @@ void TestDeserialization::testDeserializeQUuid_data()
     QTest::newRow("Object") << QJsonValue(QJsonObject()) << QUuid() << false;
 }
 
+// Test: deserialize<QUuid>() method with compact encoding -----------------------------------------
+
+void TestDeserialization::testDeserializeQUuidCompact()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(QUuid, expectedOutput);
+    QFETCH(bool, expectedResult);
+
+    QUuid output;
+    const bool result = CedarFramework::deserialize(
+                            input, &output, CedarFramework::EncodingProfile::compact());
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(output, expectedOutput);
+    }
+}
+
+void TestDeserialization::testDeserializeQUuidCompact_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<QUuid>("expectedOutput");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("String: null") << QJsonValue("AAAAAAAAAAAAAAAAAAAAAA") << QUuid() << true;
+    QTest::newRow("String: ASNFZ4mrze8BI0VniavN7w")
+            << QJsonValue("ASNFZ4mrze8BI0VniavN7w")
+            << QUuid("{01234567-89ab-cdef-0123-456789abcdef}")
+            << true;
+    QTest::newRow("String: {01234567-89ab-cdef-0123-456789abcdef}")
+            << QJsonValue("{01234567-89ab-cdef-0123-456789abcdef}")
+            << QUuid("{01234567-89ab-cdef-0123-456789abcdef}")
+            << true;
+
+    // Negative tests
+    QTest::newRow("String: invalid") << QJsonValue("ASNFZ4mrze8BI0VniavN7!") << QUuid() << false;
+    QTest::newRow("Double: 1.0") << QJsonValue(1.0) << QUuid() << false;
+}
+
 // Test: deserialize<QLocale>() method -------------------------------------------------------------
 
 void TestDeserialization::testDeserializeQLocale()
@@ -2861,16 +3331,56 @@ void TestDeserialization::testDeserializeQRect_data()
     }
 }
 
-// Test: deserialize<QRectF>() method --------------------------------------------------------------
+// Test: deserialize<QRect>() method with compact encoding -----------------------------------------
 
-void TestDeserialization::testDeserializeQRectF()
+void TestDeserialization::testDeserializeQRectCompact()
 {
     QFETCH(QJsonValue, input);
-    QFETCH(QRectF, expectedOutput);
+    QFETCH(QRect, expectedOutput);
     QFETCH(bool, expectedResult);
 
-    QRectF output;
-    const bool result = CedarFramework::deserialize(input, &output);
+    QRect output;
+    const bool result = CedarFramework::deserialize(
+                            input, &output, CedarFramework::EncodingProfile::compact());
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(output, expectedOutput);
+    }
+}
+
+void TestDeserialization::testDeserializeQRectCompact_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<QRect>("expectedOutput");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("Array") << QJsonValue(QJsonArray { 1, 2, 3, 4 }) << QRect(1, 2, 3, 4) << true;
+    QTest::newRow("Object")
+            << QJsonValue(QJsonObject { { "x", 1 }, { "y", 2 }, { "width", 3 }, { "height", 4 } })
+            << QRect(1, 2, 3, 4)
+            << true;
+
+    // Negative tests
+    QTest::newRow("Array: empty") << QJsonValue(QJsonArray()) << QRect() << false;
+    QTest::newRow("Array: too few items")
+            << QJsonValue(QJsonArray { 1, 2, 3 }) << QRect() << false;
+    QTest::newRow("Array: invalid item")
+            << QJsonValue(QJsonArray { 1, 2, "a", 4 }) << QRect() << false;
+}
+
+// Test: deserialize<QRectF>() method --------------------------------------------------------------
+
+void TestDeserialization::testDeserializeQRectF()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(QRectF, expectedOutput);
+    QFETCH(bool, expectedResult);
+
+    QRectF output;
+    const bool result = CedarFramework::deserialize(input, &output);
     QCOMPARE(result, expectedResult);
 
     if (result)
@@ -3644,6 +4154,47 @@ void TestDeserialization::testDeserializeStdPair_data()
     }
 }
 
+// Test: deserialize<std::pair>() method with compact encoding -------------------------------------
+
+void TestDeserialization::testDeserializeStdPairCompact()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(StdPairStringInt, expectedOutput);
+    QFETCH(bool, expectedResult);
+
+    StdPairStringInt output;
+    const bool result = CedarFramework::deserialize(
+                            input, &output, CedarFramework::EncodingProfile::compact());
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(output, expectedOutput);
+    }
+}
+
+void TestDeserialization::testDeserializeStdPairCompact_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<StdPairStringInt>("expectedOutput");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("Array")
+            << QJsonValue(QJsonArray { "asd", 123 }) << StdPairStringInt("asd", 123) << true;
+    QTest::newRow("Object")
+            << QJsonValue(QJsonObject { { "first", "asd" }, { "second", 123 } })
+            << StdPairStringInt("asd", 123)
+            << true;
+
+    // Negative tests
+    QTest::newRow("Array: empty") << QJsonValue(QJsonArray()) << StdPairStringInt() << false;
+    QTest::newRow("Array: too many items")
+            << QJsonValue(QJsonArray { "asd", 123, 456 }) << StdPairStringInt() << false;
+    QTest::newRow("Array: invalid second")
+            << QJsonValue(QJsonArray { "asd", "abc" }) << StdPairStringInt() << false;
+}
+
 // Test: deserialize<QList>() method ---------------------------------------------------------------
 
 void TestDeserialization::testDeserializeQList()
@@ -3861,6 +4412,197 @@ void TestDeserialization::testDeserializeQSet_data()
     QTest::newRow("array: invalid 2") << QJsonValue(QJsonArray { 1, 1 }) << QSet<int>() << false;
 }
 
+// Test: deserialize<QVarLengthArray>() method -----------------------------------------------------
+
+void TestDeserialization::testDeserializeQVarLengthArray()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(QVector<int>, expectedOutput);
+    QFETCH(bool, expectedResult);
+
+    QVarLengthArray<int, 2> output;
+    const bool result = CedarFramework::deserialize(input, &output);
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(toVector(output), expectedOutput);
+    }
+}
+
+void TestDeserialization::testDeserializeQVarLengthArray_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<QVector<int>>("expectedOutput");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("array: empty") << QJsonValue(QJsonArray()) << QVector<int>() << true;
+    QTest::newRow("array: non-empty")
+            << QJsonValue(QJsonArray { -1, 0, 1 }) << QVector<int> { -1, 0, 1 } << true;
+
+    // Negative tests
+    QTest::newRow("null")   << QJsonValue()              << QVector<int>() << false;
+    QTest::newRow("object") << QJsonValue(QJsonObject()) << QVector<int>() << false;
+
+    QTest::newRow("array: invalid") << QJsonValue(QJsonArray { 1, "a" }) << QVector<int>() << false;
+}
+
+// Test: deserialize<std::deque>() method ----------------------------------------------------------
+
+void TestDeserialization::testDeserializeStdDeque()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(QVector<int>, expectedOutput);
+    QFETCH(bool, expectedResult);
+
+    std::deque<int> output;
+    const bool result = CedarFramework::deserialize(input, &output);
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(toVector(output), expectedOutput);
+    }
+}
+
+void TestDeserialization::testDeserializeStdDeque_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<QVector<int>>("expectedOutput");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("array: empty") << QJsonValue(QJsonArray()) << QVector<int>() << true;
+    QTest::newRow("array: non-empty")
+            << QJsonValue(QJsonArray { -1, 0, 1 }) << QVector<int> { -1, 0, 1 } << true;
+
+    // Negative tests
+    QTest::newRow("null")   << QJsonValue()              << QVector<int>() << false;
+    QTest::newRow("object") << QJsonValue(QJsonObject()) << QVector<int>() << false;
+
+    QTest::newRow("array: invalid") << QJsonValue(QJsonArray { 1, "a" }) << QVector<int>() << false;
+}
+
+// Test: deserialize<std::array>() method ----------------------------------------------------------
+
+void TestDeserialization::testDeserializeStdArray()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(QVector<int>, expectedOutput);
+    QFETCH(bool, expectedResult);
+
+    std::array<int, 3> output {};
+    const bool result = CedarFramework::deserialize(input, &output);
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(toVector(output), expectedOutput);
+    }
+}
+
+void TestDeserialization::testDeserializeStdArray_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<QVector<int>>("expectedOutput");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("array: non-empty")
+            << QJsonValue(QJsonArray { -1, 0, 1 }) << QVector<int> { -1, 0, 1 } << true;
+
+    // Negative tests
+    QTest::newRow("null")   << QJsonValue()              << QVector<int>() << false;
+    QTest::newRow("object") << QJsonValue(QJsonObject()) << QVector<int>() << false;
+
+    QTest::newRow("array: empty") << QJsonValue(QJsonArray()) << QVector<int>() << false;
+    QTest::newRow("array: too short")
+            << QJsonValue(QJsonArray { 1, 2 }) << QVector<int>() << false;
+    QTest::newRow("array: too long")
+            << QJsonValue(QJsonArray { 1, 2, 3, 4 }) << QVector<int>() << false;
+    QTest::newRow("array: invalid")
+            << QJsonValue(QJsonArray { 1, "a", 3 }) << QVector<int>() << false;
+}
+
+// Test: deserialize<std::set>() method ------------------------------------------------------------
+
+void TestDeserialization::testDeserializeStdSet()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(QVector<int>, expectedOutput);
+    QFETCH(bool, expectedResult);
+
+    std::set<int> output;
+    const bool result = CedarFramework::deserialize(input, &output);
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(toVector(output), expectedOutput);
+    }
+}
+
+void TestDeserialization::testDeserializeStdSet_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<QVector<int>>("expectedOutput");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("array: empty") << QJsonValue(QJsonArray()) << QVector<int>() << true;
+    QTest::newRow("array: non-empty")
+            << QJsonValue(QJsonArray { 1, -1, 0 }) << QVector<int> { -1, 0, 1 } << true;
+
+    // Negative tests
+    QTest::newRow("null")   << QJsonValue()              << QVector<int>() << false;
+    QTest::newRow("object") << QJsonValue(QJsonObject()) << QVector<int>() << false;
+
+    QTest::newRow("array: invalid 1")
+            << QJsonValue(QJsonArray { "asd" }) << QVector<int>() << false;
+    QTest::newRow("array: invalid 2")
+            << QJsonValue(QJsonArray { 1, 1 }) << QVector<int>() << false;
+}
+
+// Test: deserialize<std::unordered_set>() method --------------------------------------------------
+
+void TestDeserialization::testDeserializeStdUnorderedSet()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(QVector<int>, expectedOutput);
+    QFETCH(bool, expectedResult);
+
+    std::unordered_set<int> output;
+    const bool result = CedarFramework::deserialize(input, &output);
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QVERIFY(output == std::unordered_set<int>(expectedOutput.begin(), expectedOutput.end()));
+    }
+}
+
+void TestDeserialization::testDeserializeStdUnorderedSet_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<QVector<int>>("expectedOutput");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("array: empty") << QJsonValue(QJsonArray()) << QVector<int>() << true;
+    QTest::newRow("array: non-empty")
+            << QJsonValue(QJsonArray { 1, -1, 0 }) << QVector<int> { -1, 0, 1 } << true;
+
+    // Negative tests
+    QTest::newRow("null")   << QJsonValue()              << QVector<int>() << false;
+    QTest::newRow("object") << QJsonValue(QJsonObject()) << QVector<int>() << false;
+
+    QTest::newRow("array: invalid 1")
+            << QJsonValue(QJsonArray { "asd" }) << QVector<int>() << false;
+    QTest::newRow("array: invalid 2")
+            << QJsonValue(QJsonArray { 1, 1 }) << QVector<int>() << false;
+}
+
 // Test: deserialize<QMap>() method ----------------------------------------------------------------
 
 using QMapIntString = QMap<int, QString>;
@@ -4085,6 +4827,22 @@ void TestDeserialization::testDeserializeStdUnorderedMap_data()
         QTest::newRow("object: non-empty") << QJsonValue(input) << expectedOutput << true;
     }
 
+    {
+        const StdUnorderedMapIntString expectedOutput
+        {
+            { std::numeric_limits<int>::lowest(), "a" },
+            { 1234567,                            "b" },
+            { std::numeric_limits<int>::max(),    "c" }
+        };
+        const QJsonObject input
+        {
+            { "-2147483648", "a" },
+            {     "1234567", "b" },
+            {  "2147483647", "c" }
+        };
+        QTest::newRow("object: large keys") << QJsonValue(input) << expectedOutput << true;
+    }
+
     // Negative tests
     QTest::newRow("null")   << QJsonValue()             << StdUnorderedMapIntString() << false;
     QTest::newRow("bool")   << QJsonValue(true)         << StdUnorderedMapIntString() << false;
@@ -4095,6 +4853,9 @@ void TestDeserialization::testDeserializeStdUnorderedMap_data()
     QTest::newRow("object: invalid key")
             << QJsonValue(QJsonObject {{"asd", "asd"}}) << StdUnorderedMapIntString() << false;
 
+    QTest::newRow("object: out of range key")
+            << QJsonValue(QJsonObject {{"2147483648", "a"}}) << StdUnorderedMapIntString() << false;
+
     QTest::newRow("object: invalid value")
             << QJsonValue(QJsonObject {{"0", 0}}) << StdUnorderedMapIntString() << false;
 }
@@ -4163,6 +4924,11 @@ void TestDeserialization::testDeserializeQMultiMap_data()
 
     QTest::newRow("object: invalid value")
             << QJsonValue(QJsonObject {{"0", 0}}) << QMultiMapIntString() << false;
+
+    QTest::newRow("object: invalid item")
+            << QJsonValue(QJsonObject {{"0", QJsonArray { "a", 0 }}})
+            << QMultiMapIntString()
+            << false;
 }
 
 // Test: deserialize<QMultiHash>() method ----------------------------------------------------------
@@ -4229,6 +4995,11 @@ void TestDeserialization::testDeserializeQMultiHash_data()
 
     QTest::newRow("object: invalid value")
             << QJsonValue(QJsonObject {{"0", 0}}) << QMultiHashIntString() << false;
+
+    QTest::newRow("object: invalid item")
+            << QJsonValue(QJsonObject {{"0", QJsonArray { "a", 0 }}})
+            << QMultiHashIntString()
+            << false;
 }
 
 // Test: deserializeNode(index) method -------------------------------------------------------------
@@ -4960,6 +5731,726 @@ void TestDeserialization::testDeserializeOptionalNodeByPathStringList_data()
             << false;
 }
 
+// Test: DeserializationErrorCollector class -------------------------------------------------------
+
+using MapStringPointList = QMap<QString, QList<QPoint>>;
+
+void TestDeserialization::testDeserializationErrorCollector()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(bool, expectedResult);
+    QFETCH(int, expectedErrorCode);
+    QFETCH(QVariantList, expectedPath);
+    QFETCH(QString, expectedText);
+
+    CedarFramework::DeserializationErrorCollector collector;
+    MapStringPointList output;
+    bool result = false;
+
+    {
+        const CedarFramework::DeserializationErrorScope scope(&collector);
+        result = CedarFramework::deserialize(input, &output);
+    }
+
+    QCOMPARE(result, expectedResult);
+    QCOMPARE(collector.hasError(), !expectedResult);
+
+    if (!result)
+    {
+        QCOMPARE(static_cast<int>(collector.errorCode()), expectedErrorCode);
+        QCOMPARE(collector.path(), expectedPath);
+        QCOMPARE(collector.toString(), expectedText);
+    }
+
+    collector.clear();
+    QVERIFY(!collector.hasError());
+    QVERIFY(collector.path().isEmpty());
+}
+
+void TestDeserialization::testDeserializationErrorCollector_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<bool>("expectedResult");
+    QTest::addColumn<int>("expectedErrorCode");
+    QTest::addColumn<QVariantList>("expectedPath");
+    QTest::addColumn<QString>("expectedText");
+
+    const QJsonObject point { { "x", 1 }, { "y", 2 } };
+    const QJsonObject invalidPoint { { "x", 1 }, { "y", "b" } };
+
+    // Positive tests
+    QTest::newRow("valid")
+            << QJsonValue(QJsonObject { { "a", QJsonArray { point, point } } })
+            << true
+            << 0
+            << QVariantList()
+            << QString();
+
+    // Negative tests
+    QTest::newRow("root")
+            << QJsonValue(QJsonArray())
+            << false
+            << static_cast<int>(CedarFramework::DeserializationErrorCode::InvalidType)
+            << QVariantList()
+            << QString("InvalidType");
+
+    QTest::newRow("list")
+            << QJsonValue(QJsonObject { { "a", point } })
+            << false
+            << static_cast<int>(CedarFramework::DeserializationErrorCode::InvalidType)
+            << QVariantList { "a" }
+            << QString("InvalidType at a");
+
+    QTest::newRow("point size")
+            << QJsonValue(QJsonObject { { "a", QJsonArray { point, QJsonObject { { "x", 1 } } } } })
+            << false
+            << static_cast<int>(CedarFramework::DeserializationErrorCode::InvalidSize)
+            << QVariantList { "a", 1 }
+            << QString("InvalidSize at a[1]");
+
+    QTest::newRow("point member")
+            << QJsonValue(QJsonObject { { "a", QJsonArray { point, invalidPoint } } })
+            << false
+            << static_cast<int>(CedarFramework::DeserializationErrorCode::InvalidValue)
+            << QVariantList { "a", 1, "y" }
+            << QString("InvalidValue at a[1].y");
+
+    QTest::newRow("out of range")
+            << QJsonValue(QJsonObject {
+                              { "a", QJsonArray { QJsonObject { { "x", 1e10 }, { "y", 2 } } } }
+                          })
+            << false
+            << static_cast<int>(CedarFramework::DeserializationErrorCode::OutOfRange)
+            << QVariantList { "a", 0, "x" }
+            << QString("OutOfRange at a[0].x");
+}
+
+// Test: DeserializationErrorCollector class with multiple errors ----------------------------------
+
+void TestDeserialization::testDeserializationErrorCollectorMultipleErrors()
+{
+    CedarFramework::DeserializationErrorCollector collector;
+    const CedarFramework::DeserializationErrorScope scope(&collector);
+
+    // Only the first error and its path are recorded
+    QVector<QVector<int>> first;
+    QVERIFY(!CedarFramework::deserialize(
+                QJsonArray { QJsonArray(), QJsonArray(), QJsonArray { 1, "a" } }, &first));
+
+    QVector<int> second;
+    QVERIFY(!CedarFramework::deserialize(QJsonArray { 1, 2, 3, 4, 5, true }, &second));
+
+    QCOMPARE(static_cast<int>(collector.errorCode()),
+             static_cast<int>(CedarFramework::DeserializationErrorCode::InvalidValue));
+    QCOMPARE(collector.path(), QVariantList({ 2, 1 }));
+    QCOMPARE(collector.toString(), QString("InvalidValue at [2][1]"));
+
+    // After clearing the next error is recorded
+    collector.clear();
+    QVERIFY(!CedarFramework::deserialize(QJsonArray { 1, 2, 3, 4, 5, true }, &second));
+    QCOMPARE(collector.path(), QVariantList({ 5 }));
+}
+
+// Test: DeserializationErrorCollector class with node functions -----------------------------------
+
+void TestDeserialization::testDeserializationErrorNodePath()
+{
+    const QJsonObject input {
+        {
+            "items",
+            QJsonArray {
+                QJsonObject { { "x", 1 }, { "y", 2 } },
+                QJsonObject { { "x", 1e10 }, { "y", 2 } }
+            }
+        },
+        { "a", QJsonArray { 1, "x" } }
+    };
+
+    CedarFramework::DeserializationErrorCollector collector;
+    const CedarFramework::DeserializationErrorScope scope(&collector);
+
+    QVector<QPoint> points;
+    QVERIFY(!CedarFramework::deserializeNode(input, QStringLiteral("items"), &points));
+    QCOMPARE(collector.toString(), QString("OutOfRange at items[1].x"));
+
+    collector.clear();
+    int value = 0;
+    QVERIFY(!CedarFramework::deserializeNode(input, QStringLiteral("missing"), &value));
+    QCOMPARE(collector.toString(), QString("NodeNotFound at missing"));
+
+    collector.clear();
+    QVERIFY(!CedarFramework::deserializeNode(input.value("a"), 1, &value));
+    QCOMPARE(collector.toString(), QString("InvalidValue at [1]"));
+
+    collector.clear();
+    QVERIFY(!CedarFramework::deserializeNode(input, QVariantList { "a", 1 }, &value));
+    QCOMPARE(collector.path(), QVariantList({ "a", 1 }));
+    QCOMPARE(collector.toString(), QString("InvalidValue at a[1]"));
+
+    collector.clear();
+    QVERIFY(!CedarFramework::deserializeNode(input, QStringList { "items", "b" }, &value));
+    QCOMPARE(collector.toString(), QString("NodeNotFound at items.b"));
+
+    collector.clear();
+    QVERIFY(!CedarFramework::deserializeOptionalNode(input, QStringLiteral("a"), &value));
+    QCOMPARE(collector.toString(), QString("InvalidType at a"));
+}
+
+// Test: inline overloads --------------------------------------------------------------------------
+
+void TestDeserialization::testInlineOverloads()
+{
+    QFETCH(QJsonValue, input);
+
+    // Inline overloads need to give the same result as the exported specializations
+    {
+        int inlineValue = 0;
+        int exportedValue = 0;
+        QCOMPARE(CedarFramework::deserialize(input, &inlineValue),
+                 CedarFramework::deserialize<int>(input, &exportedValue));
+        QCOMPARE(inlineValue, exportedValue);
+    }
+
+    {
+        unsigned long long inlineValue = 0ULL;
+        unsigned long long exportedValue = 0ULL;
+        QCOMPARE(CedarFramework::deserialize(input, &inlineValue),
+                 CedarFramework::deserialize<unsigned long long>(input, &exportedValue));
+        QCOMPARE(inlineValue, exportedValue);
+    }
+
+    {
+        float inlineValue = 0.0F;
+        float exportedValue = 0.0F;
+        QCOMPARE(CedarFramework::deserialize(input, &inlineValue),
+                 CedarFramework::deserialize<float>(input, &exportedValue));
+        QCOMPARE(inlineValue, exportedValue);
+    }
+
+    {
+        bool inlineValue = false;
+        bool exportedValue = false;
+        QCOMPARE(CedarFramework::deserialize(input, &inlineValue),
+                 CedarFramework::deserialize<bool>(input, &exportedValue));
+        QCOMPARE(inlineValue, exportedValue);
+    }
+
+    {
+        QString inlineValue;
+        QString exportedValue;
+        QCOMPARE(CedarFramework::deserialize(input, &inlineValue),
+                 CedarFramework::deserialize<QString>(input, &exportedValue));
+        QCOMPARE(inlineValue, exportedValue);
+    }
+}
+
+void TestDeserialization::testInlineOverloads_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+
+    QTest::newRow("bool") << QJsonValue(true);
+    QTest::newRow("zero") << QJsonValue(0);
+    QTest::newRow("negative") << QJsonValue(-1);
+    QTest::newRow("fraction") << QJsonValue(2.5);
+    QTest::newRow("large") << QJsonValue(1e10);
+    QTest::newRow("huge") << QJsonValue(1e300);
+    QTest::newRow("string number") << QJsonValue("123");
+    QTest::newRow("string") << QJsonValue("true");
+    QTest::newRow("null") << QJsonValue();
+}
+
+// Test: deserializeInto() method ------------------------------------------------------------------
+
+void TestDeserialization::testDeserializeInto()
+{
+    // Items of a vector are overwritten in place together with their nested storage
+    {
+        std::vector<std::vector<int>> value(3, std::vector<int>(100));
+        const int *nestedData = value[0].data();
+
+        const QJsonArray input { QJsonArray { 1, 2, 3 }, QJsonArray { 4 } };
+        QVERIFY(CedarFramework::deserializeInto(input, &value));
+
+        const std::vector<std::vector<int>> expectedValue { { 1, 2, 3 }, { 4 } };
+        QVERIFY(value == expectedValue);
+        QVERIFY(value[0].data() == nestedData);
+        QVERIFY(value[0].capacity() >= 100U);
+    }
+
+    // QVector keeps its capacity
+    {
+        QVector<double> value(100);
+
+        QVERIFY(CedarFramework::deserializeInto(QJsonArray { 1.5, 2.5 }, &value));
+        QCOMPARE(value, QVector<double>({ 1.5, 2.5 }));
+        QVERIFY(value.capacity() >= 100);
+    }
+
+    // Items of a map with the same keys are updated in place
+    {
+        QHash<QString, QVector<int>> value {
+            { "a", QVector<int>(100) }, { "b", QVector<int>(100) }
+        };
+        const int *nestedData = value["a"].constData();
+
+        const QJsonObject input { { "a", QJsonArray { 1 } }, { "b", QJsonArray { 2, 3 } } };
+        QVERIFY(CedarFramework::deserializeInto(input, &value));
+
+        const QHash<QString, QVector<int>> expectedValue {
+            { "a", QVector<int>({ 1 }) }, { "b", QVector<int>({ 2, 3 }) }
+        };
+        QCOMPARE(value, expectedValue);
+        QVERIFY(value["a"].constData() == nestedData);
+    }
+
+    // Map with different keys is rebuilt
+    {
+        std::map<QString, int> value { { "a", 1 }, { "b", 2 } };
+
+        QVERIFY(CedarFramework::deserializeInto(QJsonObject { { "a", 3 }, { "c", 4 } }, &value));
+
+        const std::map<QString, int> expectedValue { { "a", 3 }, { "c", 4 } };
+        QVERIFY(value == expectedValue);
+    }
+
+    // Map with different members that match the same key is rebuilt
+    {
+        QMap<int, int> value { { 1, 1 }, { 2, 2 } };
+
+        QVERIFY(CedarFramework::deserializeInto(QJsonObject { { "01", 3 }, { "1", 4 } }, &value));
+        QVERIFY(!value.contains(2));
+        QCOMPARE(value.size(), 1);
+    }
+
+    // Failure
+    {
+        std::vector<int> value { 1, 2, 3 };
+        QVERIFY(!CedarFramework::deserializeInto(QJsonArray { 1, "a" }, &value));
+    }
+
+    // Storage is reused only during the call
+    QVERIFY(!CedarFramework::Internal::isStorageReuseEnabled());
+}
+
+#ifdef CEDARFRAMEWORK_HAS_STD_PMR
+// Test: deserialize() method with std::pmr containers ---------------------------------------------
+
+void TestDeserialization::testDeserializePmrContainers()
+{
+    using Items = std::pmr::vector<std::pmr::string>;
+
+    const QJsonValue input = QJsonArray {
+        QJsonObject {
+            { "first-key-with-a-long-name", QJsonArray { "first-value-with-a-long-text" } },
+            { "second-key-with-a-long-name", QJsonArray { "second-value-with-a-long-text" } }
+        }
+    };
+
+    // Any allocation from the default memory resource fails, so all of the nested containers need
+    // to be allocated from the memory resource of the outer container
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::memory_resource *previousResource =
+            std::pmr::set_default_resource(std::pmr::null_memory_resource());
+
+    std::pmr::vector<std::pmr::map<std::pmr::string, Items>> orderedValue(&arena);
+    const bool orderedResult = CedarFramework::deserialize(input, &orderedValue);
+
+    std::pmr::vector<std::pmr::unordered_map<std::pmr::string, Items>> unorderedValue(&arena);
+    const bool unorderedResult = CedarFramework::deserialize(input, &unorderedValue);
+
+    std::pmr::set_default_resource(previousResource);
+
+    QVERIFY(orderedResult);
+    QCOMPARE(orderedValue.size(), static_cast<std::size_t>(1));
+    QCOMPARE(orderedValue[0].size(), static_cast<std::size_t>(2));
+
+    const auto &orderedItems = orderedValue[0].at("first-key-with-a-long-name");
+    QCOMPARE(orderedItems.size(), static_cast<std::size_t>(1));
+    QVERIFY(orderedItems[0] == "first-value-with-a-long-text");
+    QVERIFY(orderedItems.get_allocator().resource() == &arena);
+    QVERIFY(orderedItems[0].get_allocator().resource() == &arena);
+
+    QVERIFY(unorderedResult);
+    QCOMPARE(unorderedValue.size(), static_cast<std::size_t>(1));
+
+    const auto &unorderedItems = unorderedValue[0].at("second-key-with-a-long-name");
+    QCOMPARE(unorderedItems.size(), static_cast<std::size_t>(1));
+    QVERIFY(unorderedItems[0] == "second-value-with-a-long-text");
+    QVERIFY(unorderedItems[0].get_allocator().resource() == &arena);
+}
+#endif
+
+// Benchmark: deserialize<std::vector<int>>() method -----------------------------------------------
+
+void TestDeserialization::benchmarkDeserializeStdVectorInt()
+{
+    QJsonArray input;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        input.append(i);
+    }
+
+    std::vector<int> output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(static_cast<int>(output.size()), input.size());
+}
+
+// Benchmark: deserialize<QVector<double>>() method ------------------------------------------------
+
+void TestDeserialization::benchmarkDeserializeQVectorDouble()
+{
+    QJsonArray input;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        input.append(static_cast<double>(i) / 4.0);
+    }
+
+    QVector<double> output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(output.size(), input.size());
+}
+
+// Benchmark: deserialize<QSet<int>>() method ------------------------------------------------------
+
+void TestDeserialization::benchmarkDeserializeQSetInt()
+{
+    QJsonArray input;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        input.append(i);
+    }
+
+    QSet<int> output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(output.size(), input.size());
+}
+
+// Benchmark: deserialize<QMap>() method -----------------------------------------------------------
+
+void TestDeserialization::benchmarkDeserializeQMap()
+{
+    const QJsonObject input = createLargeObject();
+    QMap<QString, int> output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(static_cast<int>(output.size()), input.size());
+}
+
+// Benchmark: deserialize<std::map>() method -------------------------------------------------------
+
+void TestDeserialization::benchmarkDeserializeStdMap()
+{
+    const QJsonObject input = createLargeObject();
+    std::map<QString, int> output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(static_cast<int>(output.size()), input.size());
+}
+
+// Benchmark: deserialize<QHash>() method ----------------------------------------------------------
+
+void TestDeserialization::benchmarkDeserializeQHash()
+{
+    const QJsonObject input = createLargeObject();
+    QHash<QString, int> output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(static_cast<int>(output.size()), input.size());
+}
+
+// Benchmark: deserialize<std::unordered_map>() method ---------------------------------------------
+
+void TestDeserialization::benchmarkDeserializeStdUnorderedMap()
+{
+    const QJsonObject input = createLargeObject();
+    std::unordered_map<int, int> output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(static_cast<int>(output.size()), input.size());
+}
+
+// Benchmark: deserialize<QMultiMap>() method ------------------------------------------------------
+
+void TestDeserialization::benchmarkDeserializeQMultiMap()
+{
+    QJsonObject input;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        QJsonArray items;
+
+        for (int j = 0; j < 10; j++)
+        {
+            items.append(i * 10 + j);
+        }
+
+        input.insert(QString::number(i), items);
+    }
+
+    QMultiMap<int, int> output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(output.size(), input.size() * 10);
+}
+
+// Benchmark: deserialize<QByteArray>() method -----------------------------------------------------
+
+void TestDeserialization::benchmarkDeserializeQByteArray()
+{
+    QFETCH(int, size);
+
+    QByteArray bytes(size, Qt::Uninitialized);
+
+    for (int i = 0; i < size; i++)
+    {
+        bytes[i] = static_cast<char>(i * 7);
+    }
+
+    const QJsonValue input(QString::fromLatin1(bytes.toBase64()));
+    QByteArray output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(output, bytes);
+}
+
+void TestDeserialization::benchmarkDeserializeQByteArray_data()
+{
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("1 KB") << 1024;
+    QTest::newRow("64 KB") << 64 * 1024;
+    QTest::newRow("1 MB") << 1024 * 1024;
+    QTest::newRow("64 MB") << 64 * 1024 * 1024;
+}
+
+// Benchmark: deserialize<std::string>() method ----------------------------------------------------
+
+void TestDeserialization::benchmarkDeserializeStdString()
+{
+    QString text;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        text += QString::fromUtf8(
+                    u8"Lorem ipsum dolor sit amet, consectetur adipiscing elit \u00e9\u20ac\n");
+    }
+
+    const QJsonValue input(text);
+    std::string output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(output, text.toStdString());
+}
+
+// Benchmark: deserialize<std::vector<std::vector<int>>>() method ----------------------------------
+
+void TestDeserialization::benchmarkDeserializeNestedVector()
+{
+    const QJsonArray input = createNestedArray();
+    std::vector<std::vector<int>> output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(static_cast<int>(output.size()), input.size());
+}
+
+// Benchmark: deserializeInto<std::vector<std::vector<int>>>() method ------------------------------
+
+void TestDeserialization::benchmarkDeserializeIntoNestedVector()
+{
+    const QJsonArray input = createNestedArray();
+    std::vector<std::vector<int>> output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserializeInto(input, &output));
+    }
+
+    QCOMPARE(static_cast<int>(output.size()), input.size());
+}
+
+// Benchmark: deserialize() method with the default allocator --------------------------------------
+
+void TestDeserialization::benchmarkDeserializeDeeplyNestedDefaultAllocator()
+{
+    using Output = std::vector<std::map<std::string, std::vector<std::string>>>;
+
+    const QJsonArray input = createDeeplyNestedArray();
+    int size = 0;
+
+    QBENCHMARK
+    {
+        Output output;
+        QVERIFY(CedarFramework::deserialize(input, &output));
+        size = static_cast<int>(output.size());
+    }
+
+    QCOMPARE(size, input.size());
+}
+
+#ifdef CEDARFRAMEWORK_HAS_STD_PMR
+// Benchmark: deserialize() method with a monotonic memory resource --------------------------------
+
+void TestDeserialization::benchmarkDeserializeDeeplyNestedPmrAllocator()
+{
+    using Output = std::pmr::vector<std::pmr::map<std::pmr::string,
+                                                  std::pmr::vector<std::pmr::string>>>;
+
+    const QJsonArray input = createDeeplyNestedArray();
+    int size = 0;
+
+    QBENCHMARK
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        Output output(&arena);
+        QVERIFY(CedarFramework::deserialize(input, &output));
+        size = static_cast<int>(output.size());
+    }
+
+    QCOMPARE(size, input.size());
+}
+#endif
+
+// Benchmark: deserialize() method with the containers instantiated in the library -----------------
+
+using ContainerBenchmark = void (*)(const QJsonValue &);
+Q_DECLARE_METATYPE(ContainerBenchmark)
+
+template<typename C>
+void benchmarkDeserializeContainer(const QJsonValue &input)
+{
+    C output;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+    }
+
+    QCOMPARE(static_cast<int>(output.size()),
+             input.isArray() ? input.toArray().size() : input.toObject().size());
+}
+
+void TestDeserialization::benchmarkDeserializeInstantiatedContainers()
+{
+    QFETCH(ContainerBenchmark, benchmark);
+    QFETCH(QJsonValue, input);
+
+    benchmark(input);
+}
+
+void TestDeserialization::benchmarkDeserializeInstantiatedContainers_data()
+{
+    QTest::addColumn<ContainerBenchmark>("benchmark");
+    QTest::addColumn<QJsonValue>("input");
+
+    QJsonArray integers;
+    QJsonArray doubles;
+    QJsonArray strings;
+    QJsonObject integerMembers;
+    QJsonObject doubleMembers;
+    QJsonObject stringMembers;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        const QString key = QString::number(i);
+
+        integers.append(i);
+        doubles.append(static_cast<double>(i) / 4.0);
+        strings.append(key);
+        integerMembers.insert(key, i);
+        doubleMembers.insert(key, static_cast<double>(i) / 4.0);
+        stringMembers.insert(key, key);
+    }
+
+    QTest::newRow("QList<int>")
+            << &benchmarkDeserializeContainer<QList<int>> << QJsonValue(integers);
+    QTest::newRow("QList<double>")
+            << &benchmarkDeserializeContainer<QList<double>> << QJsonValue(doubles);
+    QTest::newRow("QList<QString>")
+            << &benchmarkDeserializeContainer<QList<QString>> << QJsonValue(strings);
+    QTest::newRow("QList<QVariant>")
+            << &benchmarkDeserializeContainer<QList<QVariant>> << QJsonValue(integers);
+    QTest::newRow("QVector<int>")
+            << &benchmarkDeserializeContainer<QVector<int>> << QJsonValue(integers);
+    QTest::newRow("QVector<double>")
+            << &benchmarkDeserializeContainer<QVector<double>> << QJsonValue(doubles);
+    QTest::newRow("QVector<QString>")
+            << &benchmarkDeserializeContainer<QVector<QString>> << QJsonValue(strings);
+    QTest::newRow("std::vector<int>")
+            << &benchmarkDeserializeContainer<std::vector<int>> << QJsonValue(integers);
+    QTest::newRow("std::vector<double>")
+            << &benchmarkDeserializeContainer<std::vector<double>> << QJsonValue(doubles);
+    QTest::newRow("std::vector<QString>")
+            << &benchmarkDeserializeContainer<std::vector<QString>> << QJsonValue(strings);
+    QTest::newRow("QMap<QString, int>")
+            << &benchmarkDeserializeContainer<QMap<QString, int>>
+            << QJsonValue(integerMembers);
+    QTest::newRow("QMap<QString, double>")
+            << &benchmarkDeserializeContainer<QMap<QString, double>>
+            << QJsonValue(doubleMembers);
+    QTest::newRow("QMap<QString, QString>")
+            << &benchmarkDeserializeContainer<QMap<QString, QString>>
+            << QJsonValue(stringMembers);
+    QTest::newRow("QMap<QString, QVariant>")
+            << &benchmarkDeserializeContainer<QMap<QString, QVariant>>
+            << QJsonValue(integerMembers);
+    QTest::newRow("QHash<QString, QString>")
+            << &benchmarkDeserializeContainer<QHash<QString, QString>>
+            << QJsonValue(stringMembers);
+    QTest::newRow("QHash<QString, QVariant>")
+            << &benchmarkDeserializeContainer<QHash<QString, QVariant>>
+            << QJsonValue(integerMembers);
+}
+
 // Main function -----------------------------------------------------------------------------------
 
 QTEST_MAIN(TestDeserialization)
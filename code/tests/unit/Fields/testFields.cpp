@@ -0,0 +1,496 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for CEDARFRAMEWORK_FIELDS() macro and FieldBinder class
+ */
+
+// Cedar Framework includes
+#include <CedarFramework/FieldBinder.hpp>
+#include <CedarFramework/Fields.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonValue>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test types --------------------------------------------------------------------------------------
+
+namespace Test
+{
+
+struct Record
+{
+    int id = 0;
+    QString name;
+    QList<double> values;
+};
+
+bool operator==(const Record &left, const Record &right)
+{
+    return (left.id == right.id) && (left.name == right.name) && (left.values == right.values);
+}
+
+// The fields are intentionally not declared in the order of their keys
+struct Event
+{
+    QString type;
+    int priority = 0;
+    bool active = false;
+    double weight = 0.0;
+};
+
+bool operator==(const Event &left, const Event &right)
+{
+    return (left.type == right.type) && (left.priority == right.priority) &&
+            (left.active == right.active) && (left.weight == right.weight);
+}
+
+struct Message
+{
+    int id = 0;
+    QString note;
+    QList<int> tags;
+};
+
+} // namespace Test
+
+CEDARFRAMEWORK_FIELDS(Test::Record, id, name, values)
+CEDARFRAMEWORK_FIELDS(Test::Event, type, priority, active, weight)
+
+namespace CedarFramework
+{
+
+template<>
+bool deserialize(const QJsonValue &json, Test::Message *value)
+{
+    FieldBinder binder;
+    binder.bind(QStringLiteral("id"), &value->id)
+          .bindOptional(QStringLiteral("note"), &value->note);
+
+    return binder.deserialize(json) &&
+            deserializeOptionalNode(json, QStringLiteral("tags"), &value->tags);
+}
+
+} // namespace CedarFramework
+
+Q_DECLARE_METATYPE(Test::Record)
+Q_DECLARE_METATYPE(Test::Event)
+
+// Test class declaration --------------------------------------------------------------------------
+
+class TestFields : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testSerializeFields();
+    void testSerializeFields_data();
+
+    void testDeserializeFields();
+    void testDeserializeFields_data();
+
+    void testDeserializeUnsortedFields();
+    void testDeserializeUnsortedFields_data();
+
+    void testDeserializeFieldsInto();
+
+    void testDeserializeOptionalMembersInto();
+
+    void testFieldBinder();
+    void testFieldBinder_data();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestFields::initTestCase()
+{
+}
+
+void TestFields::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestFields::init()
+{
+}
+
+void TestFields::cleanup()
+{
+}
+
+// Test: serialize<Test::Record>() method ----------------------------------------------------------
+
+void TestFields::testSerializeFields()
+{
+    QFETCH(Test::Record, input);
+    QFETCH(QJsonValue, expectedResult);
+
+    const QJsonValue result = CedarFramework::serialize(input);
+    QCOMPARE(result, expectedResult);
+}
+
+void TestFields::testSerializeFields_data()
+{
+    QTest::addColumn<Test::Record>("input");
+    QTest::addColumn<QJsonValue>("expectedResult");
+
+    Test::Record record;
+    record.id = 1;
+    record.name = "a";
+    record.values = QList<double> { 1.5, 2.5 };
+
+    QTest::newRow("default")
+            << Test::Record()
+            << QJsonValue(QJsonObject { { "id", 0 }, { "name", "" }, { "values", QJsonArray() } });
+
+    QTest::newRow("values")
+            << record
+            << QJsonValue(QJsonObject {
+                              { "id", 1 }, { "name", "a" }, { "values", QJsonArray { 1.5, 2.5 } }
+                          });
+}
+
+// Test: deserialize<Test::Record>() method --------------------------------------------------------
+
+void TestFields::testDeserializeFields()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(bool, expectedResult);
+    QFETCH(Test::Record, expectedValue);
+
+    Test::Record value;
+    const bool result = CedarFramework::deserialize(input, &value);
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(value, expectedValue);
+    }
+}
+
+void TestFields::testDeserializeFields_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<bool>("expectedResult");
+    QTest::addColumn<Test::Record>("expectedValue");
+
+    Test::Record record;
+    record.id = 1;
+    record.name = "a";
+    record.values = QList<double> { 1.5, 2.5 };
+
+    // Positive tests
+    QTest::newRow("valid")
+            << QJsonValue(QJsonObject {
+                              { "id", 1 }, { "name", "a" }, { "values", QJsonArray { 1.5, 2.5 } }
+                          })
+            << true
+            << record;
+
+    QTest::newRow("unknown member")
+            << QJsonValue(QJsonObject {
+                              { "id", 1 },
+                              { "name", "a" },
+                              { "other", true },
+                              { "values", QJsonArray { 1.5, 2.5 } }
+                          })
+            << true
+            << record;
+
+    // Negative tests
+    QTest::newRow("invalid type") << QJsonValue(QJsonArray()) << false << Test::Record();
+
+    QTest::newRow("missing member")
+            << QJsonValue(QJsonObject { { "id", 1 }, { "values", QJsonArray { 1.5, 2.5 } } })
+            << false
+            << Test::Record();
+
+    QTest::newRow("invalid member")
+            << QJsonValue(QJsonObject {
+                              { "id", "b" }, { "name", "a" }, { "values", QJsonArray { 1.5, 2.5 } }
+                          })
+            << false
+            << Test::Record();
+}
+
+// Test: deserialize<Test::Event>() method ---------------------------------------------------------
+
+void TestFields::testDeserializeUnsortedFields()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(bool, expectedResult);
+    QFETCH(Test::Event, expectedValue);
+
+    Test::Event value;
+    const bool result = CedarFramework::deserialize(input, &value);
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(value, expectedValue);
+        QCOMPARE(CedarFramework::serialize(value), QJsonValue(QJsonObject {
+                                                                  { "active", value.active },
+                                                                  { "priority", value.priority },
+                                                                  { "type", value.type },
+                                                                  { "weight", value.weight }
+                                                              }));
+    }
+}
+
+void TestFields::testDeserializeUnsortedFields_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<bool>("expectedResult");
+    QTest::addColumn<Test::Event>("expectedValue");
+
+    Test::Event event;
+    event.type = "click";
+    event.priority = 2;
+    event.active = true;
+    event.weight = 0.5;
+
+    // Positive tests
+    QTest::newRow("all fields")
+            << QJsonValue(QJsonObject {
+                              { "type", "click" },
+                              { "priority", 2 },
+                              { "active", true },
+                              { "weight", 0.5 }
+                          })
+            << true
+            << event;
+    QTest::newRow("unknown members between the fields")
+            << QJsonValue(QJsonObject {
+                              { "a", 1 },
+                              { "active", true },
+                              { "b", 2 },
+                              { "priority", 2 },
+                              { "q", 3 },
+                              { "type", "click" },
+                              { "u", 4 },
+                              { "weight", 0.5 },
+                              { "z", 5 }
+                          })
+            << true
+            << event;
+
+    // Negative tests
+    QTest::newRow("missing first field")
+            << QJsonValue(QJsonObject { { "type", "click" }, { "priority", 2 }, { "weight", 0.5 } })
+            << false
+            << Test::Event();
+    QTest::newRow("missing last field")
+            << QJsonValue(QJsonObject {
+                              { "type", "click" }, { "priority", 2 }, { "active", true }
+                          })
+            << false
+            << Test::Event();
+    QTest::newRow("missing field replaced by an unknown member")
+            << QJsonValue(QJsonObject {
+                              { "active", true },
+                              { "prio", 2 },
+                              { "type", "click" },
+                              { "weight", 0.5 }
+                          })
+            << false
+            << Test::Event();
+    QTest::newRow("invalid field")
+            << QJsonValue(QJsonObject {
+                              { "type", "click" },
+                              { "priority", "high" },
+                              { "active", true },
+                              { "weight", 0.5 }
+                          })
+            << false
+            << Test::Event();
+}
+
+// Test: deserializeInto<std::vector<Test::Record>>() method ---------------------------------------
+
+void TestFields::testDeserializeFieldsInto()
+{
+    std::vector<Test::Record> value(3);
+    const Test::Record *data = value.data();
+
+    Test::Record record;
+    record.id = 1;
+    record.name = "a";
+    record.values = QList<double> { 1.5, 2.5 };
+
+    const QJsonArray input {
+        QJsonObject { { "id", 0 }, { "name", "" }, { "values", QJsonArray() } },
+        QJsonObject { { "id", 1 }, { "name", "a" }, { "values", QJsonArray { 1.5, 2.5 } } }
+    };
+
+    QVERIFY(CedarFramework::deserializeInto(input, &value));
+    QCOMPARE(value.size(), static_cast<std::size_t>(2));
+    QVERIFY(value.data() == data);
+    QCOMPARE(value[0], Test::Record());
+    QCOMPARE(value[1], record);
+}
+
+// Test: deserializeInto() method with missing optional members ------------------------------------
+
+void TestFields::testDeserializeOptionalMembersInto()
+{
+    QVector<Test::Message> value;
+
+    // The optional members of the reused messages are reset if they are missing in the next message
+    const QJsonArray firstInput {
+        QJsonObject { { "id", 1 }, { "note", "a" }, { "tags", QJsonArray { 1, 2 } } }
+    };
+    QVERIFY(CedarFramework::deserializeInto(firstInput, &value));
+    QCOMPARE(value.size(), 1);
+    QCOMPARE(value.at(0).note, QString("a"));
+    QCOMPARE(value.at(0).tags, QList<int>({ 1, 2 }));
+
+    const QJsonArray secondInput { QJsonObject { { "id", 2 } } };
+    QVERIFY(CedarFramework::deserializeInto(secondInput, &value));
+    QCOMPARE(value.size(), 1);
+    QCOMPARE(value.at(0).id, 2);
+    QVERIFY(value.at(0).note.isNull());
+    QVERIFY(value.at(0).tags.isEmpty());
+
+    // Without storage reuse the missing optional members are left as they are
+    Test::Message message;
+    message.note = "b";
+    QVERIFY(CedarFramework::deserialize(QJsonObject { { "id", 3 } }, &message));
+    QCOMPARE(message.note, QString("b"));
+}
+
+// Test: FieldBinder class -------------------------------------------------------------------------
+
+void TestFields::testFieldBinder()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(bool, expectedResult);
+    QFETCH(int, expectedId);
+    QFETCH(QString, expectedName);
+    QFETCH(bool, expectedTagsDeserialized);
+    QFETCH(QStringList, expectedUnknownKeys);
+
+    int id = 0;
+    QString name;
+    QStringList tags;
+    bool tagsDeserialized = false;
+
+    CedarFramework::FieldBinder binder;
+    binder.bind(QStringLiteral("name"), &name)
+          .bind(QStringLiteral("id"), &id)
+          .bindOptional(QStringLiteral("tags"), &tags, &tagsDeserialized);
+
+    QStringList unknownKeys;
+    const bool result = binder.deserialize(input, &unknownKeys);
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(id, expectedId);
+        QCOMPARE(name, expectedName);
+        QCOMPARE(tagsDeserialized, expectedTagsDeserialized);
+        QCOMPARE(unknownKeys, expectedUnknownKeys);
+    }
+}
+
+void TestFields::testFieldBinder_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<bool>("expectedResult");
+    QTest::addColumn<int>("expectedId");
+    QTest::addColumn<QString>("expectedName");
+    QTest::addColumn<bool>("expectedTagsDeserialized");
+    QTest::addColumn<QStringList>("expectedUnknownKeys");
+
+    // Positive tests
+    QTest::newRow("all")
+            << QJsonValue(QJsonObject {
+                              { "id", 1 }, { "name", "a" }, { "tags", QJsonArray { "b" } }
+                          })
+            << true
+            << 1
+            << QString("a")
+            << true
+            << QStringList();
+
+    QTest::newRow("required")
+            << QJsonValue(QJsonObject { { "id", 1 }, { "name", "a" } })
+            << true
+            << 1
+            << QString("a")
+            << false
+            << QStringList();
+
+    QTest::newRow("unknown")
+            << QJsonValue(QJsonObject { { "a", 0 }, { "id", 1 }, { "name", "a" }, { "x", 0 } })
+            << true
+            << 1
+            << QString("a")
+            << false
+            << QStringList { "a", "x" };
+
+    // Negative tests
+    QTest::newRow("invalid type")
+            << QJsonValue(QJsonArray()) << false << 0 << QString() << false << QStringList();
+
+    QTest::newRow("missing required")
+            << QJsonValue(QJsonObject { { "id", 1 }, { "tags", QJsonArray { "b" } } })
+            << false
+            << 0
+            << QString()
+            << false
+            << QStringList();
+
+    QTest::newRow("invalid required")
+            << QJsonValue(QJsonObject { { "id", "b" }, { "name", "a" } })
+            << false
+            << 0
+            << QString()
+            << false
+            << QStringList();
+
+    QTest::newRow("invalid optional")
+            << QJsonValue(QJsonObject { { "id", 1 }, { "name", "a" }, { "tags", 1 } })
+            << false
+            << 0
+            << QString()
+            << false
+            << QStringList();
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestFields)
+#include "testFields.moc"
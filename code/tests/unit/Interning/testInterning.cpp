@@ -0,0 +1,651 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for the interning of the deserialized values
+ */
+
+// Cedar Framework includes
+#include <CedarFramework/Deserialization.hpp>
+#include <CedarFramework/Interning.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonValue>
+#include <QtTest/QTest>
+
+// System includes
+#include <string>
+#include <thread>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+class TestInterning : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testGlobalPool();
+
+    void testScope();
+
+    void testLocale();
+
+    void testUrl();
+
+    void testString();
+    void testString_data();
+
+    void testStatistics();
+
+    void testStatisticsMultipleThreads();
+
+    void testClear();
+
+    void testCapacity();
+
+    void testFrontCache();
+
+    void testDeserialize();
+
+    void testDeserializeStrings();
+
+    void testDeserializeWithoutPool();
+
+    void testDeserializeStdStrings();
+
+    // Benchmarks
+    void benchmarkDeserializeUrls();
+    void benchmarkDeserializeUrls_data();
+
+    void benchmarkDeserializeLocales();
+    void benchmarkDeserializeLocales_data();
+
+    void benchmarkDeserializeRecords();
+    void benchmarkDeserializeRecords_data();
+};
+
+// Helper methods ----------------------------------------------------------------------------------
+
+QJsonArray createRepeatedValues(const QStringList &values, const int size)
+{
+    QJsonArray array;
+
+    for (int i = 0; i < size; i++)
+    {
+        array.append(values.at(i % values.size()));
+    }
+
+    return array;
+}
+
+QJsonArray createRecords(const int size)
+{
+    const QStringList states = { "pending", "active", "suspended", "closed" };
+    QJsonArray records;
+
+    for (int i = 0; i < size; i++)
+    {
+        records.append(QJsonObject {
+                           { "state", states.at(i % states.size()) },
+                           { "priority", (i % 3 == 0) ? "high" : "normal" }
+                       });
+    }
+
+    return records;
+}
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestInterning::initTestCase()
+{
+}
+
+void TestInterning::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestInterning::init()
+{
+}
+
+void TestInterning::cleanup()
+{
+}
+
+// Test: process-wide pool -------------------------------------------------------------------------
+
+void TestInterning::testGlobalPool()
+{
+    QCOMPARE(&CedarFramework::InterningPool::global(), &CedarFramework::InterningPool::global());
+    QVERIFY(CedarFramework::activeInterningPool() == nullptr);
+}
+
+// Test: interning scope ---------------------------------------------------------------------------
+
+void TestInterning::testScope()
+{
+    CedarFramework::InterningPool outerPool;
+    CedarFramework::InterningPool innerPool;
+
+    {
+        CedarFramework::InterningScope outerScope(outerPool);
+        QCOMPARE(CedarFramework::activeInterningPool(), &outerPool);
+
+        {
+            CedarFramework::InterningScope innerScope(innerPool);
+            QCOMPARE(CedarFramework::activeInterningPool(), &innerPool);
+        }
+
+        QCOMPARE(CedarFramework::activeInterningPool(), &outerPool);
+    }
+
+    QVERIFY(CedarFramework::activeInterningPool() == nullptr);
+}
+
+// Test: locale() method ---------------------------------------------------------------------------
+
+void TestInterning::testLocale()
+{
+    CedarFramework::InterningPool pool;
+
+    const QLocale first = pool.locale("de_AT");
+    const QLocale second = pool.locale("de_AT");
+    const QLocale third = pool.locale("en_GB");
+
+    QCOMPARE(first, QLocale("de_AT"));
+    QCOMPARE(second, first);
+    QCOMPARE(third, QLocale("en_GB"));
+    QCOMPARE(pool.size(), 2);
+}
+
+// Test: url() method ------------------------------------------------------------------------------
+
+void TestInterning::testUrl()
+{
+    CedarFramework::InterningPool pool;
+
+    const QUrl first = pool.url("https://www.example.com/a");
+    const QUrl second = pool.url("https://www.example.com/a");
+    const QUrl third = pool.url("https://www.example.com/b");
+
+    QCOMPARE(first, QUrl("https://www.example.com/a"));
+    QCOMPARE(second, first);
+    QCOMPARE(third, QUrl("https://www.example.com/b"));
+    QCOMPARE(pool.size(), 2);
+
+    // The interned value is shared with the pool
+    QVERIFY(!second.isDetached());
+}
+
+// Test: string() method ---------------------------------------------------------------------------
+
+void TestInterning::testString()
+{
+    QFETCH(QString, input);
+    QFETCH(bool, expectedInterned);
+
+    CedarFramework::InterningPool pool;
+
+    const QString first = pool.string(input);
+    const QString second = pool.string(QString(input.constData(), input.size()));
+
+    QCOMPARE(first, input);
+    QCOMPARE(second, input);
+    QCOMPARE(pool.size(), expectedInterned ? 1 : 0);
+
+    if (expectedInterned)
+    {
+        // The second string shares its storage with the interned string
+        QVERIFY(!second.isDetached());
+        QCOMPARE(second.constData(), first.constData());
+        QCOMPARE(pool.statistics().savedBytes, static_cast<quint64>(input.size() * 2));
+    }
+}
+
+void TestInterning::testString_data()
+{
+    QTest::addColumn<QString>("input");
+    QTest::addColumn<bool>("expectedInterned");
+
+    QTest::newRow("short") << QString("active") << true;
+    QTest::newRow("maximum length") << QString(64, 'a') << true;
+
+    QTest::newRow("empty") << QString() << false;
+    QTest::newRow("too long") << QString(65, 'a') << false;
+}
+
+// Test: statistics() method -----------------------------------------------------------------------
+
+void TestInterning::testStatistics()
+{
+    CedarFramework::InterningPool pool;
+
+    auto statistics = pool.statistics();
+    QCOMPARE(statistics.hits, static_cast<quint64>(0));
+    QCOMPARE(statistics.misses, static_cast<quint64>(0));
+    QCOMPARE(statistics.savedBytes, static_cast<quint64>(0));
+
+    pool.string("abc");
+    pool.string("abc");
+    pool.string("abc");
+    pool.string("de");
+    pool.locale("de_AT");
+    pool.locale("de_AT");
+    pool.url("https://www.example.com");
+
+    // Only the shared string data is counted in the saved bytes
+    statistics = pool.statistics();
+    QCOMPARE(statistics.hits, static_cast<quint64>(3));
+    QCOMPARE(statistics.misses, static_cast<quint64>(4));
+    QCOMPARE(statistics.savedBytes, static_cast<quint64>(2 * 3 * 2));
+}
+
+// Test: statistics() method with multiple threads -------------------------------------------------
+
+void TestInterning::testStatisticsMultipleThreads()
+{
+    CedarFramework::InterningPool pool;
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 8; i++)
+    {
+        threads.emplace_back([&pool]()
+        {
+            // The pool is only active in the thread that activated it
+            CedarFramework::InterningScope scope(pool);
+
+            for (int j = 0; j < 1000; j++)
+            {
+                CedarFramework::activeInterningPool()->string("active");
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    QVERIFY(CedarFramework::activeInterningPool() == nullptr);
+
+    // The lookups of all the threads are counted
+    const auto statistics = pool.statistics();
+    QCOMPARE(statistics.hits + statistics.misses, static_cast<quint64>(8 * 1000));
+    QVERIFY(statistics.misses >= static_cast<quint64>(1));
+    QCOMPARE(statistics.savedBytes, statistics.hits * 6 * 2);
+    QCOMPARE(pool.size(), 1);
+}
+
+// Test: clear() method ----------------------------------------------------------------------------
+
+void TestInterning::testClear()
+{
+    CedarFramework::InterningPool pool;
+    pool.locale("de_AT");
+    pool.url("https://www.example.com");
+    pool.string("active");
+    pool.string("active");
+    QCOMPARE(pool.size(), 3);
+
+    pool.clear();
+    QCOMPARE(pool.size(), 0);
+    QCOMPARE(pool.statistics().hits, static_cast<quint64>(0));
+    QCOMPARE(pool.statistics().misses, static_cast<quint64>(0));
+    QCOMPARE(pool.statistics().savedBytes, static_cast<quint64>(0));
+}
+
+// Test: capacity() and setCapacity() methods ------------------------------------------------------
+
+void TestInterning::testCapacity()
+{
+    QCOMPARE(CedarFramework::InterningPool().capacity(), 65536);
+
+    CedarFramework::InterningPool pool(2);
+    QCOMPARE(pool.capacity(), 2);
+
+    pool.locale("de_AT");
+    pool.string("active");
+
+    // The pool is full, so the new values are returned without being interned
+    QCOMPARE(pool.url("https://www.example.com"), QUrl("https://www.example.com"));
+    QCOMPARE(pool.locale("en_GB"), QLocale("en_GB"));
+
+    const QString input("closed");
+    const QString notInterned = pool.string(QString(input.constData(), input.size()));
+    QCOMPARE(notInterned, input);
+    QVERIFY(notInterned.constData() != pool.string(input).constData());
+    QCOMPARE(pool.size(), 2);
+
+    // The already interned values are still shared
+    const QString first = pool.string("active");
+    const QString second = pool.string("active");
+    QCOMPARE(second.constData(), first.constData());
+    QCOMPARE(pool.statistics().hits, static_cast<quint64>(2));
+
+    // A lower capacity keeps the interned values
+    pool.setCapacity(0);
+    QCOMPARE(pool.capacity(), 0);
+    QCOMPARE(pool.size(), 2);
+
+    pool.clear();
+    pool.string("active");
+    QCOMPARE(pool.size(), 0);
+
+    pool.setCapacity(-1);
+    QCOMPARE(pool.capacity(), 0);
+
+    pool.setCapacity(10);
+    pool.string("active");
+    QCOMPARE(pool.size(), 1);
+}
+
+// Test: front cache of the current thread ---------------------------------------------------------
+
+void TestInterning::testFrontCache()
+{
+    CedarFramework::InterningPool firstPool;
+    CedarFramework::InterningPool secondPool;
+
+    // The front cache of the first pool isn't used for the second pool
+    const QString first = firstPool.string("active");
+    const QString second = secondPool.string("active");
+    QCOMPARE(firstPool.size(), 1);
+    QCOMPARE(secondPool.size(), 1);
+    QCOMPARE(secondPool.statistics().misses, static_cast<quint64>(1));
+
+    // Repeated lookups in the same thread share the interned string
+    QCOMPARE(firstPool.string("active").constData(), first.constData());
+    QCOMPARE(secondPool.string("active").constData(), second.constData());
+    QCOMPARE(firstPool.statistics().hits, static_cast<quint64>(1));
+
+    // Clearing the pool invalidates the front cache
+    firstPool.clear();
+    firstPool.string("active");
+    QCOMPARE(firstPool.size(), 1);
+    QCOMPARE(firstPool.statistics().hits, static_cast<quint64>(0));
+    QCOMPARE(firstPool.statistics().misses, static_cast<quint64>(1));
+
+    // A new pool doesn't see the values of a destroyed pool
+    for (int i = 0; i < 2; i++)
+    {
+        CedarFramework::InterningPool pool;
+        pool.locale("de_AT");
+        QCOMPARE(pool.size(), 1);
+        QCOMPARE(pool.statistics().misses, static_cast<quint64>(1));
+    }
+}
+
+// Test: deserialization with an active pool -------------------------------------------------------
+
+void TestInterning::testDeserialize()
+{
+    CedarFramework::InterningPool pool;
+    CedarFramework::InterningScope scope(pool);
+
+    const QJsonArray urlInput = createRepeatedValues(
+                                    { "https://www.example.com/a", "https://www.example.com/b" },
+                                    100);
+    QVector<QUrl> urls;
+    QVERIFY(CedarFramework::deserialize(urlInput, &urls));
+    QCOMPARE(urls.size(), 100);
+    QCOMPARE(urls.at(98), QUrl("https://www.example.com/a"));
+    QCOMPARE(urls.at(99), QUrl("https://www.example.com/b"));
+    QCOMPARE(pool.size(), 2);
+
+    const QJsonArray localeInput = createRepeatedValues({ "de_AT", "en_GB", "ru_RU" }, 100);
+    QVector<QLocale> locales;
+    QVERIFY(CedarFramework::deserialize(localeInput, &locales));
+    QCOMPARE(locales.size(), 100);
+    QCOMPARE(locales.at(99), QLocale("de_AT"));
+    QCOMPARE(pool.size(), 5);
+
+    // Invalid values are still rejected
+    QUrl url;
+    QVERIFY(!CedarFramework::deserialize(QJsonValue("&http://www.example.com"), &url));
+    QVERIFY(!CedarFramework::deserialize(QJsonValue("&http://www.example.com"), &url));
+}
+
+// Test: deserialization of strings with an active pool --------------------------------------------
+
+void TestInterning::testDeserializeStrings()
+{
+    CedarFramework::InterningPool pool;
+    CedarFramework::InterningScope scope(pool);
+
+    const QJsonArray input = createRepeatedValues({ "active", "closed" }, 100);
+    QVector<QString> values;
+    QVERIFY(CedarFramework::deserialize(input, &values));
+    QCOMPARE(values.size(), 100);
+    QCOMPARE(values.at(0), QString("active"));
+    QCOMPARE(values.at(99), QString("closed"));
+    QCOMPARE(values.at(98).constData(), values.at(0).constData());
+    QCOMPARE(pool.size(), 2);
+
+    auto statistics = pool.statistics();
+    QCOMPARE(statistics.hits, static_cast<quint64>(98));
+    QCOMPARE(statistics.misses, static_cast<quint64>(2));
+    QCOMPARE(statistics.savedBytes, static_cast<quint64>(98 * 6 * 2));
+
+    const QJsonArray records = createRecords(100);
+    QVector<QHash<QString, QString>> hashes;
+    QVERIFY(CedarFramework::deserialize(records, &hashes));
+    QCOMPARE(hashes.size(), 100);
+    QCOMPARE(hashes.at(1).value("state"), QString("active"));
+
+    QVector<QMap<QString, QString>> maps;
+    QVERIFY(CedarFramework::deserialize(records, &maps));
+    QCOMPARE(maps.size(), 100);
+    QCOMPARE(maps.at(99).value("priority"), QString("high"));
+    QCOMPARE(maps.at(99).firstKey().constData(), maps.at(0).firstKey().constData());
+
+    // Keys: "priority", "state" and values: "pending", "suspended", "high", "normal"
+    QCOMPARE(pool.size(), 8);
+}
+
+// Test: deserialization without an active pool ----------------------------------------------------
+
+void TestInterning::testDeserializeWithoutPool()
+{
+    CedarFramework::InterningPool pool;
+
+    {
+        CedarFramework::InterningScope scope(pool);
+    }
+
+    QUrl url;
+    QVERIFY(CedarFramework::deserialize(QJsonValue("https://www.example.com"), &url));
+    QCOMPARE(url, QUrl("https://www.example.com"));
+
+    QLocale locale;
+    QVERIFY(CedarFramework::deserialize(QJsonValue("de_AT"), &locale));
+    QCOMPARE(locale, QLocale("de_AT"));
+
+    QCOMPARE(pool.size(), 0);
+}
+
+// Test: deserialization of std string types with an active pool -----------------------------------
+
+void TestInterning::testDeserializeStdStrings()
+{
+    CedarFramework::InterningPool pool;
+    CedarFramework::InterningScope scope(pool);
+
+    // Only the converted value is kept, so the std string types don't use the pool
+    std::string stdString;
+    QVERIFY(CedarFramework::deserialize(QJsonValue("active"), &stdString));
+    QVERIFY(stdString == std::string("active"));
+
+    std::wstring wideString;
+    QVERIFY(CedarFramework::deserialize(QJsonValue("active"), &wideString));
+    QVERIFY(wideString == std::wstring(L"active"));
+
+    std::u16string utf16String;
+    QVERIFY(CedarFramework::deserialize(QJsonValue("active"), &utf16String));
+    QVERIFY(utf16String == std::u16string(u"active"));
+
+    std::u32string utf32String;
+    QVERIFY(CedarFramework::deserialize(QJsonValue("active"), &utf32String));
+    QVERIFY(utf32String == std::u32string(U"active"));
+
+#ifdef CEDARFRAMEWORK_HAS_STD_PMR
+    std::pmr::string pmrString;
+    QVERIFY(CedarFramework::deserialize(QJsonValue("active"), &pmrString));
+    QVERIFY(pmrString == "active");
+#endif
+
+    QCOMPARE(pool.size(), 0);
+    QCOMPARE(pool.statistics().hits, static_cast<quint64>(0));
+    QCOMPARE(pool.statistics().misses, static_cast<quint64>(0));
+}
+
+// Benchmark: deserialization of URLs --------------------------------------------------------------
+
+void TestInterning::benchmarkDeserializeUrls()
+{
+    QFETCH(bool, interning);
+
+    const QJsonArray input = createRepeatedValues(
+                                 {
+                                     "https://www.example.com/api/v1/items",
+                                     "https://www.example.com/api/v1/users",
+                                     "https://www.example.com/api/v1/orders"
+                                 },
+                                 10000);
+    CedarFramework::InterningPool pool;
+    QVector<QUrl> output;
+
+    QBENCHMARK
+    {
+        if (interning)
+        {
+            CedarFramework::InterningScope scope(pool);
+            QVERIFY(CedarFramework::deserialize(input, &output));
+        }
+        else
+        {
+            QVERIFY(CedarFramework::deserialize(input, &output));
+        }
+    }
+
+    QCOMPARE(output.size(), 10000);
+}
+
+void TestInterning::benchmarkDeserializeUrls_data()
+{
+    QTest::addColumn<bool>("interning");
+
+    QTest::newRow("without interning") << false;
+    QTest::newRow("with interning") << true;
+}
+
+// Benchmark: deserialization of locales -----------------------------------------------------------
+
+void TestInterning::benchmarkDeserializeLocales()
+{
+    QFETCH(bool, interning);
+
+    const QJsonArray input = createRepeatedValues({ "de_AT", "en_GB", "ru_RU" }, 10000);
+    CedarFramework::InterningPool pool;
+    QVector<QLocale> output;
+
+    QBENCHMARK
+    {
+        if (interning)
+        {
+            CedarFramework::InterningScope scope(pool);
+            QVERIFY(CedarFramework::deserialize(input, &output));
+        }
+        else
+        {
+            QVERIFY(CedarFramework::deserialize(input, &output));
+        }
+    }
+
+    QCOMPARE(output.size(), 10000);
+}
+
+void TestInterning::benchmarkDeserializeLocales_data()
+{
+    QTest::addColumn<bool>("interning");
+
+    QTest::newRow("without interning") << false;
+    QTest::newRow("with interning") << true;
+}
+
+// Benchmark: deserialization of records -----------------------------------------------------------
+
+void TestInterning::benchmarkDeserializeRecords()
+{
+    QFETCH(bool, interning);
+
+    const QJsonArray input = createRecords(10000);
+    CedarFramework::InterningPool pool;
+    QVector<QMap<QString, QString>> output;
+
+    QBENCHMARK
+    {
+        if (interning)
+        {
+            CedarFramework::InterningScope scope(pool);
+            QVERIFY(CedarFramework::deserialize(input, &output));
+        }
+        else
+        {
+            QVERIFY(CedarFramework::deserialize(input, &output));
+        }
+    }
+
+    QCOMPARE(output.size(), 10000);
+
+    // Keys: "priority", "state" and values: 4 states, "high", "normal"
+    if (interning)
+    {
+        QCOMPARE(pool.size(), 8);
+        QVERIFY(pool.statistics().savedBytes > 0);
+    }
+}
+
+void TestInterning::benchmarkDeserializeRecords_data()
+{
+    QTest::addColumn<bool>("interning");
+
+    QTest::newRow("without interning") << false;
+    QTest::newRow("with interning") << true;
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestInterning)
+#include "testInterning.moc"
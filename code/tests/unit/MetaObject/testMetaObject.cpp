@@ -0,0 +1,336 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for serialization and deserialization of Q_GADGET and QObject properties
+ */
+
+// Cedar Framework includes
+#include <CedarFramework/Deserialization.hpp>
+#include <CedarFramework/MetaObject.hpp>
+#include <CedarFramework/Serialization.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonValue>
+#include <QtCore/QSize>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test types --------------------------------------------------------------------------------------
+
+class Settings
+{
+    Q_GADGET
+    Q_PROPERTY(int count MEMBER count)
+    Q_PROPERTY(QString name MEMBER name)
+    Q_PROPERTY(Mode mode MEMBER mode)
+    Q_PROPERTY(QSize size MEMBER size)
+
+public:
+    enum class Mode
+    {
+        Off,
+        On
+    };
+    Q_ENUM(Mode)
+
+    bool operator==(const Settings &other) const
+    {
+        return (count == other.count) &&
+                (name == other.name) &&
+                (mode == other.mode) &&
+                (size == other.size);
+    }
+
+    int count = 0;
+    QString name;
+    Mode mode = Mode::Off;
+    QSize size;
+};
+
+Q_DECLARE_METATYPE(Settings)
+
+class Window
+{
+    Q_GADGET
+    Q_PROPERTY(QString title MEMBER title)
+    Q_PROPERTY(Settings settings MEMBER settings)
+
+public:
+    bool operator==(const Window &other) const
+    {
+        return (title == other.title) && (settings == other.settings);
+    }
+
+    QString title;
+    Settings settings;
+};
+
+Q_DECLARE_METATYPE(Window)
+
+class Device : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int level MEMBER level)
+    Q_PROPERTY(QString label MEMBER label)
+    Q_PROPERTY(QString id READ id CONSTANT)
+
+public:
+    QString id() const
+    {
+        return QStringLiteral("device");
+    }
+
+    int level = 0;
+    QString label;
+};
+
+// Test class declaration --------------------------------------------------------------------------
+
+class TestMetaObject : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testSerializeGadget();
+    void testSerializeGadget_data();
+
+    void testDeserializeGadget();
+    void testDeserializeGadget_data();
+
+    void testDeserializeGadgetReusedStorage();
+
+    void testSerializeObject();
+    void testDeserializeObject();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestMetaObject::initTestCase()
+{
+}
+
+void TestMetaObject::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestMetaObject::init()
+{
+}
+
+void TestMetaObject::cleanup()
+{
+}
+
+// Test: serializeGadget() method ------------------------------------------------------------------
+
+void TestMetaObject::testSerializeGadget()
+{
+    QFETCH(Window, input);
+    QFETCH(QJsonValue, expectedResult);
+
+    QCOMPARE(CedarFramework::serializeGadget(input), expectedResult);
+
+    // Serialization of the gadget in a QVariant needs to give the same result
+    QCOMPARE(CedarFramework::serialize(QVariant::fromValue(input)), expectedResult);
+}
+
+void TestMetaObject::testSerializeGadget_data()
+{
+    QTest::addColumn<Window>("input");
+    QTest::addColumn<QJsonValue>("expectedResult");
+
+    Window window;
+    window.title = "a";
+    window.settings.count = 1;
+    window.settings.name = "b";
+    window.settings.mode = Settings::Mode::On;
+    window.settings.size = QSize(2, 3);
+
+    QTest::newRow("default")
+            << Window()
+            << QJsonValue(QJsonObject {
+                              { "title", "" },
+                              {
+                                  "settings",
+                                  QJsonObject {
+                                      { "count", 0 },
+                                      { "name", "" },
+                                      { "mode", "Off" },
+                                      { "size", QJsonObject { { "width", -1 }, { "height", -1 } } }
+                                  }
+                              }
+                          });
+
+    QTest::newRow("values")
+            << window
+            << QJsonValue(QJsonObject {
+                              { "title", "a" },
+                              {
+                                  "settings",
+                                  QJsonObject {
+                                      { "count", 1 },
+                                      { "name", "b" },
+                                      { "mode", "On" },
+                                      { "size", QJsonObject { { "width", 2 }, { "height", 3 } } }
+                                  }
+                              }
+                          });
+}
+
+// Test: deserializeGadget() method ----------------------------------------------------------------
+
+void TestMetaObject::testDeserializeGadget()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(bool, expectedResult);
+    QFETCH(Settings, expectedValue);
+
+    Settings value;
+    const bool result = CedarFramework::deserializeGadget(input, &value);
+    QCOMPARE(result, expectedResult);
+
+    if (result)
+    {
+        QCOMPARE(value, expectedValue);
+
+        // Deserialization into a QVariant holding the gadget needs to give the same result
+        QVariant variantValue = QVariant::fromValue(Settings());
+        QVERIFY(CedarFramework::deserialize(input, &variantValue));
+        QCOMPARE(variantValue.value<Settings>(), expectedValue);
+    }
+}
+
+void TestMetaObject::testDeserializeGadget_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<bool>("expectedResult");
+    QTest::addColumn<Settings>("expectedValue");
+
+    Settings settings;
+    settings.count = 1;
+    settings.name = "b";
+    settings.mode = Settings::Mode::On;
+    settings.size = QSize(2, 3);
+
+    Settings partialSettings;
+    partialSettings.name = "b";
+
+    // Positive tests
+    QTest::newRow("all")
+            << QJsonValue(QJsonObject {
+                              { "count", 1 },
+                              { "name", "b" },
+                              { "mode", "On" },
+                              { "size", QJsonObject { { "width", 2 }, { "height", 3 } } }
+                          })
+            << true
+            << settings;
+
+    QTest::newRow("partial")
+            << QJsonValue(QJsonObject { { "name", "b" }, { "other", 1 } })
+            << true
+            << partialSettings;
+
+    // Negative tests
+    QTest::newRow("invalid type") << QJsonValue(QJsonArray()) << false << Settings();
+
+    QTest::newRow("invalid member")
+            << QJsonValue(QJsonObject { { "count", "c" } })
+            << false
+            << Settings();
+
+    QTest::newRow("invalid enum")
+            << QJsonValue(QJsonObject { { "mode", "Unknown" } })
+            << false
+            << Settings();
+}
+
+// Test: deserializeGadget() method with reused storage --------------------------------------------
+
+void TestMetaObject::testDeserializeGadgetReusedStorage()
+{
+    Settings value;
+    value.count = 5;
+    value.name = "a";
+    value.mode = Settings::Mode::On;
+    value.size = QSize(1, 2);
+
+    // The properties that are missing in the next message are reset
+    const CedarFramework::Internal::StorageReuseScope scope;
+    QVERIFY(CedarFramework::deserializeGadget(QJsonObject { { "count", 6 } }, &value));
+
+    Settings expectedValue;
+    expectedValue.count = 6;
+    QCOMPARE(value, expectedValue);
+}
+
+// Test: serializeObject() method ------------------------------------------------------------------
+
+void TestMetaObject::testSerializeObject()
+{
+    Device device;
+    device.setObjectName("device");
+    device.level = 1;
+    device.label = "a";
+
+    const QJsonValue expectedResult = QJsonObject {
+        { "level", 1 }, { "label", "a" }, { "id", "device" }
+    };
+
+    QCOMPARE(CedarFramework::serializeObject(device), expectedResult);
+    QCOMPARE(CedarFramework::serialize(QVariant::fromValue<QObject *>(&device)), expectedResult);
+}
+
+// Test: deserializeObject() method ----------------------------------------------------------------
+
+void TestMetaObject::testDeserializeObject()
+{
+    Device device;
+
+    QVERIFY(CedarFramework::deserializeObject(
+                QJsonObject { { "level", 2 }, { "label", "b" }, { "id", "other" } },
+                &device));
+    QCOMPARE(device.level, 2);
+    QCOMPARE(device.label, QString("b"));
+
+    QVERIFY(!CedarFramework::deserializeObject(QJsonObject { { "level", "c" } }, &device));
+    QVERIFY(!CedarFramework::deserializeObject(QJsonArray(), &device));
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestMetaObject)
+#include "testMetaObject.moc"
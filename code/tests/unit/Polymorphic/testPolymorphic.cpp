@@ -0,0 +1,423 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for serialization and deserialization of polymorphic types and std::variant
+ */
+
+// Cedar Framework includes
+#include <CedarFramework/Polymorphic.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonValue>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test types --------------------------------------------------------------------------------------
+
+namespace Test
+{
+
+struct Shape
+{
+    virtual ~Shape() = default;
+    virtual double area() const = 0;
+};
+
+struct Circle : Shape
+{
+    double area() const override
+    {
+        return 3.0 * radius * radius;
+    }
+
+    double radius = 0.0;
+};
+
+struct Rectangle : Shape
+{
+    double area() const override
+    {
+        return width * height;
+    }
+
+    double width = 0.0;
+    double height = 0.0;
+};
+
+struct Triangle : Shape
+{
+    double area() const override
+    {
+        return 0.0;
+    }
+};
+
+} // namespace Test
+
+CEDARFRAMEWORK_TYPE_TAG(Test::Circle, "circle")
+CEDARFRAMEWORK_TYPE_TAG(Test::Rectangle, "rectangle")
+
+#ifdef CEDARFRAMEWORK_HAS_STD_VARIANT
+CEDARFRAMEWORK_TYPE_TAG(int, "int")
+CEDARFRAMEWORK_TYPE_TAG(QString, "string")
+#endif
+
+namespace CedarFramework
+{
+
+template<>
+QJsonValue serialize(const Test::Circle &value)
+{
+    return QJsonObject { { "radius", value.radius } };
+}
+
+template<>
+bool deserialize(const QJsonValue &json, Test::Circle *value)
+{
+    return deserializeNode(json, QStringLiteral("radius"), &value->radius);
+}
+
+template<>
+QJsonValue serialize(const Test::Rectangle &value)
+{
+    return QJsonObject { { "width", value.width }, { "height", value.height } };
+}
+
+template<>
+bool deserialize(const QJsonValue &json, Test::Rectangle *value)
+{
+    return deserializeNode(json, QStringLiteral("width"), &value->width) &&
+            deserializeNode(json, QStringLiteral("height"), &value->height);
+}
+
+} // namespace CedarFramework
+
+// Test class declaration --------------------------------------------------------------------------
+
+class TestPolymorphic : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testUniquePtrRoundTrip();
+    void testUniquePtrRoundTrip_data();
+
+    void testSharedPtrRoundTrip();
+
+    void testNullPointer();
+
+    void testSerializeUnregisteredType();
+
+    void testRegistryDuplicateTag();
+
+    void testRegistryReregisteredType();
+
+    void testDeserializeUniquePtr();
+    void testDeserializeUniquePtr_data();
+
+#ifdef CEDARFRAMEWORK_HAS_STD_VARIANT
+    void testVariantRoundTrip();
+
+    void testDeserializeVariant();
+    void testDeserializeVariant_data();
+#endif
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestPolymorphic::initTestCase()
+{
+    CedarFramework::registerPolymorphicType<Test::Shape, Test::Circle>();
+    CedarFramework::registerPolymorphicType<Test::Shape, Test::Rectangle>();
+}
+
+void TestPolymorphic::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestPolymorphic::init()
+{
+}
+
+void TestPolymorphic::cleanup()
+{
+}
+
+// Test: std::unique_ptr round trip ----------------------------------------------------------------
+
+void TestPolymorphic::testUniquePtrRoundTrip()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(double, expectedArea);
+
+    std::unique_ptr<Test::Shape> value;
+    QVERIFY(CedarFramework::deserialize(input, &value));
+    QVERIFY(value);
+    QCOMPARE(value->area(), expectedArea);
+
+    QCOMPARE(CedarFramework::serialize(value), input);
+}
+
+void TestPolymorphic::testUniquePtrRoundTrip_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<double>("expectedArea");
+
+    QTest::newRow("circle")
+            << QJsonValue(QJsonObject {
+                              { "type", "circle" },
+                              { "value", QJsonObject { { "radius", 2.0 } } }
+                          })
+            << 12.0;
+
+    QTest::newRow("rectangle")
+            << QJsonValue(QJsonObject {
+                              { "type", "rectangle" },
+                              { "value", QJsonObject { { "width", 2.0 }, { "height", 3.0 } } }
+                          })
+            << 6.0;
+}
+
+// Test: std::shared_ptr round trip ----------------------------------------------------------------
+
+void TestPolymorphic::testSharedPtrRoundTrip()
+{
+    auto rectangle = std::make_shared<Test::Rectangle>();
+    rectangle->width = 4.0;
+    rectangle->height = 0.5;
+
+    const std::shared_ptr<Test::Shape> input = rectangle;
+    const QJsonValue serializedValue = CedarFramework::serialize(input);
+    QCOMPARE(serializedValue.toObject().value("type").toString(), QString("rectangle"));
+
+    std::shared_ptr<Test::Shape> output;
+    QVERIFY(CedarFramework::deserialize(serializedValue, &output));
+    QVERIFY(dynamic_cast<Test::Rectangle *>(output.get()) != nullptr);
+    QCOMPARE(output->area(), 2.0);
+}
+
+// Test: null pointer ------------------------------------------------------------------------------
+
+void TestPolymorphic::testNullPointer()
+{
+    const std::unique_ptr<Test::Shape> input;
+    QCOMPARE(CedarFramework::serialize(input), QJsonValue(QJsonValue::Null));
+
+    std::unique_ptr<Test::Shape> output(new Test::Circle());
+    QVERIFY(CedarFramework::deserialize(QJsonValue::Null, &output));
+    QVERIFY(!output);
+}
+
+// Test: serialization of an unregistered type -----------------------------------------------------
+
+void TestPolymorphic::testSerializeUnregisteredType()
+{
+    const std::unique_ptr<Test::Shape> input(new Test::Triangle());
+    QVERIFY(CedarFramework::serialize(input).isUndefined());
+}
+
+// Test: registration of a type tag that is already registered -------------------------------------
+
+void TestPolymorphic::testRegistryDuplicateTag()
+{
+    using Registry = CedarFramework::Internal::PolymorphicTypeRegistry<Test::Shape>;
+    Registry registry;
+
+    Registry::Entry circleEntry;
+    circleEntry.tag = QStringLiteral("shape");
+    circleEntry.factory = &CedarFramework::Internal::deserializeDerived<Test::Shape, Test::Circle>;
+    QVERIFY(registry.add(std::type_index(typeid(Test::Circle)), circleEntry));
+
+    // Another type with the same tag is rejected and doesn't replace the registered type
+    Registry::Entry rectangleEntry;
+    rectangleEntry.tag = QStringLiteral("shape");
+    rectangleEntry.factory =
+            &CedarFramework::Internal::deserializeDerived<Test::Shape, Test::Rectangle>;
+    QVERIFY(!registry.add(std::type_index(typeid(Test::Rectangle)), rectangleEntry));
+
+    Registry::Entry entry;
+    QVERIFY(registry.find(QStringLiteral("shape"), &entry));
+    QVERIFY(entry.factory == circleEntry.factory);
+    QVERIFY(!registry.find(std::type_index(typeid(Test::Rectangle)), &entry));
+
+    // Adding the same type with the same tag again is allowed
+    QVERIFY(registry.add(std::type_index(typeid(Test::Circle)), circleEntry));
+}
+
+// Test: registration of a type that is already registered -----------------------------------------
+
+void TestPolymorphic::testRegistryReregisteredType()
+{
+    using Registry = CedarFramework::Internal::PolymorphicTypeRegistry<Test::Shape>;
+    Registry registry;
+
+    Registry::Entry circleEntry;
+    circleEntry.tag = QStringLiteral("circle");
+    QVERIFY(registry.add(std::type_index(typeid(Test::Circle)), circleEntry));
+
+    Registry::Entry rectangleEntry;
+    rectangleEntry.tag = QStringLiteral("rectangle");
+    QVERIFY(registry.add(std::type_index(typeid(Test::Rectangle)), rectangleEntry));
+
+    // The new tag replaces the old tag of the type
+    circleEntry.tag = QStringLiteral("round");
+    QVERIFY(registry.add(std::type_index(typeid(Test::Circle)), circleEntry));
+
+    Registry::Entry entry;
+    QVERIFY(!registry.find(QStringLiteral("circle"), &entry));
+    QVERIFY(registry.find(QStringLiteral("round"), &entry));
+    QVERIFY(registry.find(std::type_index(typeid(Test::Circle)), &entry));
+    QCOMPARE(entry.tag, QStringLiteral("round"));
+
+    // The tag of another type can't be taken over and the type keeps its current tag
+    circleEntry.tag = QStringLiteral("rectangle");
+    QVERIFY(!registry.add(std::type_index(typeid(Test::Circle)), circleEntry));
+    QVERIFY(registry.find(std::type_index(typeid(Test::Circle)), &entry));
+    QCOMPARE(entry.tag, QStringLiteral("round"));
+    QVERIFY(registry.find(QStringLiteral("rectangle"), &entry));
+}
+
+// Test: deserialization of std::unique_ptr --------------------------------------------------------
+
+void TestPolymorphic::testDeserializeUniquePtr()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(bool, expectedResult);
+
+    std::unique_ptr<Test::Shape> output;
+    QCOMPARE(CedarFramework::deserialize(input, &output), expectedResult);
+    QCOMPARE(static_cast<bool>(output), expectedResult);
+}
+
+void TestPolymorphic::testDeserializeUniquePtr_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("circle")
+            << QJsonValue(QJsonObject {
+                              { "type", "circle" },
+                              { "value", QJsonObject { { "radius", 1.0 } } }
+                          })
+            << true;
+
+    // Negative tests
+    QTest::newRow("invalid: type") << QJsonValue(QJsonArray { "circle", 1.0 }) << false;
+    QTest::newRow("invalid: no value") << QJsonValue(QJsonObject { { "type", "circle" } }) << false;
+
+    QTest::newRow("invalid: extra member")
+            << QJsonValue(QJsonObject {
+                              { "type", "circle" },
+                              { "value", QJsonObject { { "radius", 1.0 } } },
+                              { "extra", 1 }
+                          })
+            << false;
+
+    QTest::newRow("invalid: tag type")
+            << QJsonValue(QJsonObject {
+                              { "type", 1 },
+                              { "value", QJsonObject { { "radius", 1.0 } } }
+                          })
+            << false;
+
+    QTest::newRow("invalid: unknown tag")
+            << QJsonValue(QJsonObject {
+                              { "type", "triangle" },
+                              { "value", QJsonObject() }
+                          })
+            << false;
+
+    QTest::newRow("invalid: value")
+            << QJsonValue(QJsonObject {
+                              { "type", "circle" },
+                              { "value", QJsonObject { { "width", 1.0 } } }
+                          })
+            << false;
+}
+
+#ifdef CEDARFRAMEWORK_HAS_STD_VARIANT
+// Test: std::variant round trip -------------------------------------------------------------------
+
+void TestPolymorphic::testVariantRoundTrip()
+{
+    using Variant = std::variant<int, QString>;
+
+    const Variant input = QString("a");
+    const QJsonValue serializedValue = CedarFramework::serialize(input);
+    QCOMPARE(serializedValue,
+             QJsonValue(QJsonObject { { "type", "string" }, { "value", "a" } }));
+
+    Variant output = 1;
+    QVERIFY(CedarFramework::deserialize(serializedValue, &output));
+    QCOMPARE(output.index(), static_cast<std::size_t>(1));
+    QCOMPARE(std::get<QString>(output), QString("a"));
+}
+
+// Test: deserialization of std::variant -----------------------------------------------------------
+
+void TestPolymorphic::testDeserializeVariant()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(bool, expectedResult);
+
+    std::variant<int, QString> output;
+    QCOMPARE(CedarFramework::deserialize(input, &output), expectedResult);
+}
+
+void TestPolymorphic::testDeserializeVariant_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("int") << QJsonValue(QJsonObject { { "type", "int" }, { "value", 1 } }) << true;
+
+    // Negative tests
+    QTest::newRow("invalid: unknown tag")
+            << QJsonValue(QJsonObject { { "type", "double" }, { "value", 1 } })
+            << false;
+
+    QTest::newRow("invalid: value")
+            << QJsonValue(QJsonObject { { "type", "int" }, { "value", "a" } })
+            << false;
+}
+#endif
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestPolymorphic)
+#include "testPolymorphic.moc"
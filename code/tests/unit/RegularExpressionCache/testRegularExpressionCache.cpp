@@ -0,0 +1,284 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for the regular expression cache
+ */
+
+// Cedar Framework includes
+#include <CedarFramework/Deserialization.hpp>
+#include <CedarFramework/RegularExpressionCache.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonValue>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+class TestRegularExpressionCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testDefaultCapacity();
+
+    void testCachedRegularExpression();
+
+    void testCachedRegExp();
+
+    void testLeastRecentlyUsedEviction();
+
+    void testDisabledCache();
+
+    void testDeserialize();
+
+    // Benchmarks
+    void benchmarkDeserializeRuleSet();
+    void benchmarkDeserializeRuleSet_data();
+};
+
+// Helper methods ----------------------------------------------------------------------------------
+
+QJsonArray createRuleSet()
+{
+    QJsonArray ruleSet;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        ruleSet.append(QJsonObject {
+                           { "pattern", QString("^rule_%1_([a-z]+)_(\\d{2,4})$").arg(i) },
+                           { "options", QJsonArray { "CaseInsensitive" } }
+                       });
+    }
+
+    return ruleSet;
+}
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestRegularExpressionCache::initTestCase()
+{
+}
+
+void TestRegularExpressionCache::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestRegularExpressionCache::init()
+{
+    CedarFramework::setRegularExpressionCacheCapacity(4096);
+    CedarFramework::clearRegularExpressionCache();
+}
+
+void TestRegularExpressionCache::cleanup()
+{
+}
+
+// Test: default capacity --------------------------------------------------------------------------
+
+void TestRegularExpressionCache::testDefaultCapacity()
+{
+    const auto statistics = CedarFramework::regularExpressionCacheStatistics();
+    QCOMPARE(statistics.capacity, 4096);
+    QCOMPARE(statistics.size, 0);
+    QCOMPARE(statistics.hits, static_cast<quint64>(0));
+    QCOMPARE(statistics.misses, static_cast<quint64>(0));
+}
+
+// Test: cachedRegularExpression() method ----------------------------------------------------------
+
+void TestRegularExpressionCache::testCachedRegularExpression()
+{
+    const auto first = CedarFramework::cachedRegularExpression(
+                           "a+b", QRegularExpression::CaseInsensitiveOption);
+    const auto second = CedarFramework::cachedRegularExpression(
+                            "a+b", QRegularExpression::CaseInsensitiveOption);
+    const auto third = CedarFramework::cachedRegularExpression("a+b");
+
+    QCOMPARE(first, QRegularExpression("a+b", QRegularExpression::CaseInsensitiveOption));
+    QCOMPARE(second, first);
+    QCOMPARE(third, QRegularExpression("a+b"));
+    QVERIFY(second.match("xAABx").hasMatch());
+    QVERIFY(!third.match("xAABx").hasMatch());
+
+    // Different options are cached separately
+    const auto statistics = CedarFramework::regularExpressionCacheStatistics();
+    QCOMPARE(statistics.hits, static_cast<quint64>(1));
+    QCOMPARE(statistics.misses, static_cast<quint64>(2));
+    QCOMPARE(statistics.size, 2);
+}
+
+// Test: cachedRegExp() method ---------------------------------------------------------------------
+
+void TestRegularExpressionCache::testCachedRegExp()
+{
+    const auto first = CedarFramework::cachedRegExp("a*", Qt::CaseSensitive, QRegExp::Wildcard);
+    const auto second = CedarFramework::cachedRegExp("a*", Qt::CaseSensitive, QRegExp::Wildcard);
+    const auto third = CedarFramework::cachedRegExp("a*", Qt::CaseSensitive, QRegExp::RegExp);
+
+    QCOMPARE(first, QRegExp("a*", Qt::CaseSensitive, QRegExp::Wildcard));
+    QCOMPARE(second, first);
+    QCOMPARE(third, QRegExp("a*", Qt::CaseSensitive, QRegExp::RegExp));
+
+    // The same pattern as a QRegularExpression is cached separately
+    const auto regularExpression = CedarFramework::cachedRegularExpression("a*");
+    QCOMPARE(regularExpression, QRegularExpression("a*"));
+
+    const auto statistics = CedarFramework::regularExpressionCacheStatistics();
+    QCOMPARE(statistics.hits, static_cast<quint64>(1));
+    QCOMPARE(statistics.misses, static_cast<quint64>(3));
+    QCOMPARE(statistics.size, 3);
+}
+
+// Test: least recently used eviction --------------------------------------------------------------
+
+void TestRegularExpressionCache::testLeastRecentlyUsedEviction()
+{
+    CedarFramework::setRegularExpressionCacheCapacity(2);
+
+    CedarFramework::cachedRegularExpression("a");
+    CedarFramework::cachedRegularExpression("b");
+    CedarFramework::cachedRegularExpression("a");
+
+    // "b" is the least recently used one so it is evicted
+    CedarFramework::cachedRegularExpression("c");
+    QCOMPARE(CedarFramework::regularExpressionCacheStatistics().size, 2);
+
+    CedarFramework::cachedRegularExpression("a");
+    CedarFramework::cachedRegularExpression("c");
+    CedarFramework::cachedRegularExpression("b");
+
+    // Hits: "a", "a", "c" and misses: "a", "b", "c", "b"
+    const auto statistics = CedarFramework::regularExpressionCacheStatistics();
+    QCOMPARE(statistics.hits, static_cast<quint64>(3));
+    QCOMPARE(statistics.misses, static_cast<quint64>(4));
+    QCOMPARE(statistics.size, 2);
+    QCOMPARE(statistics.capacity, 2);
+}
+
+// Test: disabled cache ----------------------------------------------------------------------------
+
+void TestRegularExpressionCache::testDisabledCache()
+{
+    CedarFramework::setRegularExpressionCacheCapacity(0);
+
+    const auto first = CedarFramework::cachedRegularExpression("a+");
+    const auto second = CedarFramework::cachedRegularExpression("a+");
+    QCOMPARE(second, first);
+
+    const auto statistics = CedarFramework::regularExpressionCacheStatistics();
+    QCOMPARE(statistics.hits, static_cast<quint64>(0));
+    QCOMPARE(statistics.misses, static_cast<quint64>(2));
+    QCOMPARE(statistics.size, 0);
+}
+
+// Test: deserialization through the cache ---------------------------------------------------------
+
+void TestRegularExpressionCache::testDeserialize()
+{
+    const QJsonValue input = QJsonObject {
+        { "pattern", "^[a-z]+$" },
+        { "options", QJsonArray { "CaseInsensitive", "Multiline" } }
+    };
+
+    QRegularExpression first;
+    QVERIFY(CedarFramework::deserialize(input, &first));
+
+    QRegularExpression second;
+    QVERIFY(CedarFramework::deserialize(input, &second));
+
+    QCOMPARE(second, first);
+    QCOMPARE(second.patternOptions(),
+             QRegularExpression::CaseInsensitiveOption | QRegularExpression::MultilineOption);
+
+    const QJsonValue regExpInput = QJsonObject {
+        { "pattern", "*.txt" },
+        { "case_sensitive", false },
+        { "syntax", "Wildcard" }
+    };
+
+    QRegExp regExp;
+    QVERIFY(CedarFramework::deserialize(regExpInput, &regExp));
+    QVERIFY(CedarFramework::deserialize(regExpInput, &regExp));
+    QCOMPARE(regExp, QRegExp("*.txt", Qt::CaseInsensitive, QRegExp::Wildcard));
+
+    const auto statistics = CedarFramework::regularExpressionCacheStatistics();
+    QCOMPARE(statistics.hits, static_cast<quint64>(2));
+    QCOMPARE(statistics.misses, static_cast<quint64>(2));
+}
+
+// Benchmark: deserialization of a rule set --------------------------------------------------------
+
+void TestRegularExpressionCache::benchmarkDeserializeRuleSet()
+{
+    QFETCH(int, capacity);
+
+    CedarFramework::setRegularExpressionCacheCapacity(capacity);
+
+    const QJsonArray input = createRuleSet();
+    QVector<QRegularExpression> output;
+    int matches = 0;
+
+    QBENCHMARK
+    {
+        QVERIFY(CedarFramework::deserialize(input, &output));
+        matches = 0;
+
+        // The first match compiles the pattern unless it was already compiled
+        for (const auto &rule : qAsConst(output))
+        {
+            if (rule.match("rule_1_abc_123").hasMatch())
+            {
+                matches++;
+            }
+        }
+    }
+
+    QCOMPARE(matches, 1);
+}
+
+void TestRegularExpressionCache::benchmarkDeserializeRuleSet_data()
+{
+    QTest::addColumn<int>("capacity");
+
+    QTest::newRow("without cache") << 0;
+    QTest::newRow("with cache") << 4096;
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestRegularExpressionCache)
+#include "testRegularExpressionCache.moc"
@@ -35,6 +35,7 @@
 #include <QtTest/QTest>
 
 // System includes
+#include <limits>
 
 // Forward declarations
 
@@ -173,6 +174,8 @@ private slots:
 
     void testSerializeQByteArray();
     void testSerializeQByteArray_data();
+    void testSerializeQByteArrayScalarCode();
+    void testSerializeQByteArrayScalarCode_data();
 
     void testSerializeQBitArray();
     void testSerializeQBitArray_data();
@@ -198,6 +201,9 @@ private slots:
     void testSerializeQDateTime();
     void testSerializeQDateTime_data();
 
+    void testSerializeCompactEncoding();
+    void testSerializeCompactEncoding_data();
+
     void testSerializeQVariant();
     void testSerializeQVariant_data();
 
@@ -281,6 +287,9 @@ private slots:
     void testSerializeStdPair();
     void testSerializeStdPair_data();
 
+    void testSerializeStdPairCompact();
+    void testSerializeStdPairCompact_data();
+
     void testSerializeQList();
     void testSerializeQList_data();
 
@@ -296,6 +305,20 @@ private slots:
     void testSerializeQSet();
     void testSerializeQSet_data();
 
+    void testSerializeQVarLengthArray();
+    void testSerializeQVarLengthArray_data();
+
+    void testSerializeStdDeque();
+    void testSerializeStdDeque_data();
+
+    void testSerializeStdArray();
+
+    void testSerializeStdSet();
+    void testSerializeStdSet_data();
+
+    void testSerializeStdUnorderedSet();
+    void testSerializeStdUnorderedSet_data();
+
     void testSerializeQMap();
     void testSerializeQMap_data();
 
@@ -313,6 +336,21 @@ private slots:
 
     void testSerializeQMultiHash();
     void testSerializeQMultiHash_data();
+
+    void testInlineOverloads();
+
+    void testJsonObjectBuilder();
+
+    // Benchmarks
+    void benchmarkSerializeStdVectorInt();
+    void benchmarkSerializeQVectorDouble();
+    void benchmarkSerializeQMultiMap();
+    void benchmarkSerializeQHash();
+    void benchmarkSerializeQByteArray();
+    void benchmarkSerializeQByteArray_data();
+    void benchmarkSerializeStdString();
+    void benchmarkSerializeInstantiatedContainers();
+    void benchmarkSerializeInstantiatedContainers_data();
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -658,6 +696,52 @@ void TestSerialization::testSerializeQByteArray_data()
     QTest::newRow("empty") << QByteArray() << QJsonValue("");
     QTest::newRow("a z A Z 0 9 + - ?") << QByteArray("a z A Z 0 9 + - ?")
                                        << QJsonValue("YSB6IEEgWiAwIDkgKyAtID8=");
+    QTest::newRow("a") << QByteArray("a") << QJsonValue("YQ==");
+    QTest::newRow("ab") << QByteArray("ab") << QJsonValue("YWI=");
+
+    QByteArray bytes;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        bytes.append(static_cast<char>(i * 7));
+    }
+
+    QTest::newRow("1000 bytes") << bytes << QJsonValue(QString::fromLatin1(bytes.toBase64()));
+}
+
+// Test: serialize<QByteArray>() method with the scalar codec --------------------------------------
+
+void TestSerialization::testSerializeQByteArrayScalarCode()
+{
+    QFETCH(int, size);
+
+    QByteArray input;
+
+    for (int i = 0; i < size; i++)
+    {
+        input.append(static_cast<char>(i * 37 + 11));
+    }
+
+    const QJsonValue expectedResult(QString::fromLatin1(input.toBase64()));
+
+    const auto result = CedarFramework::serialize(input);
+    QCOMPARE(result, expectedResult);
+
+    CedarFramework::Internal::ScalarCodeScope scalarCodeScope;
+
+    const auto scalarResult = CedarFramework::serialize(input);
+    QCOMPARE(scalarResult, expectedResult);
+}
+
+void TestSerialization::testSerializeQByteArrayScalarCode_data()
+{
+    QTest::addColumn<int>("size");
+
+    // Sizes around the 12 byte blocks of the SIMD codec and its 16 byte loads
+    for (int size : {0, 1, 11, 12, 13, 15, 16, 17, 23, 24, 25, 31, 32, 33, 47, 48, 49, 1000})
+    {
+        QTest::addRow("%d bytes", size) << size;
+    }
 }
 
 // Test: serialize<QBitArray>() method -------------------------------------------------------------
@@ -731,6 +815,12 @@ void TestSerialization::testSerializeStdString_data()
     QTest::newRow("empty") << std::string() << QJsonValue("");
     QTest::newRow("a z A Z 0 9 + - ?") << std::string("a z A Z 0 9 + - ?")
                                        << QJsonValue("a z A Z 0 9 + - ?");
+    QTest::newRow("non-ASCII")
+            << std::string(u8"0123456789abcdef \u00e9 \u20ac \U0001F600 0123456789abcdef")
+            << QJsonValue(QString::fromUtf8(u8"0123456789abcdef \u00e9 \u20ac "
+                                            u8"\U0001F600 0123456789abcdef"));
+    QTest::newRow("invalid UTF-8") << std::string("a\xC3")
+                                   << QJsonValue(QString("a") + QChar(QChar::ReplacementCharacter));
 }
 
 // Test: serialize<std::wstring>() method ----------------------------------------------------------
@@ -754,6 +844,10 @@ void TestSerialization::testSerializeStdWString_data()
     QTest::newRow("empty") << std::wstring() << QJsonValue("");
     QTest::newRow("a z A Z 0 9 + - ?") << std::wstring(L"a z A Z 0 9 + - ?")
                                        << QJsonValue("a z A Z 0 9 + - ?");
+    QTest::newRow("non-ASCII")
+            << std::wstring(L"0123456789abcdef \u00e9 \u20ac \U0001F600 0123456789abcdef")
+            << QJsonValue(QString::fromUtf8(u8"0123456789abcdef \u00e9 \u20ac "
+                                            u8"\U0001F600 0123456789abcdef"));
 }
 
 // Test: serialize<std::u16string>() method --------------------------------------------------------
@@ -777,6 +871,10 @@ void TestSerialization::testSerializeStdU16String_data()
     QTest::newRow("empty") << std::u16string() << QJsonValue("");
     QTest::newRow("a z A Z 0 9 + - ?") << std::u16string(u"a z A Z 0 9 + - ?")
                                        << QJsonValue("a z A Z 0 9 + - ?");
+    QTest::newRow("non-ASCII")
+            << std::u16string(u"0123456789abcdef \u00e9 \u20ac \U0001F600 0123456789abcdef")
+            << QJsonValue(QString::fromUtf8(u8"0123456789abcdef \u00e9 \u20ac "
+                                            u8"\U0001F600 0123456789abcdef"));
 }
 
 // Test: serialize<std::u32string>() method --------------------------------------------------------
@@ -800,6 +898,12 @@ void TestSerialization::testSerializeStdU32String_data()
     QTest::newRow("empty") << std::u32string() << QJsonValue("");
     QTest::newRow("a z A Z 0 9 + - ?") << std::u32string(U"a z A Z 0 9 + - ?")
                                        << QJsonValue("a z A Z 0 9 + - ?");
+    QTest::newRow("non-ASCII")
+            << std::u32string(U"0123456789abcdef \u00e9 \u20ac \U0001F600 0123456789abcdef")
+            << QJsonValue(QString::fromUtf8(u8"0123456789abcdef \u00e9 \u20ac "
+                                            u8"\U0001F600 0123456789abcdef"));
+    QTest::newRow("invalid code point") << std::u32string(1, static_cast<char32_t>(0x110000))
+                                        << QJsonValue(QString(QChar(QChar::ReplacementCharacter)));
 }
 
 // Test: serialize<QDate>() method -----------------------------------------------------------------
@@ -820,6 +924,7 @@ void TestSerialization::testSerializeQDate_data()
 
     QTest::newRow("empty") << QDate() << QJsonValue("");
     QTest::newRow("2020-08-05") << QDate(2020, 8, 5) << QJsonValue("2020-08-05");
+    QTest::newRow("0001-01-01") << QDate(1, 1, 1) << QJsonValue("0001-01-01");
 }
 
 // Test: serialize<QTime>() method -----------------------------------------------------------------
@@ -840,6 +945,7 @@ void TestSerialization::testSerializeQTime_data()
 
     QTest::newRow("empty") << QTime() << QJsonValue("");
     QTest::newRow("12:34:56.789") << QTime(12, 34, 56, 789) << QJsonValue("12:34:56.789");
+    QTest::newRow("00:00:00.000") << QTime(0, 0) << QJsonValue("00:00:00.000");
 }
 
 // Test: serialize<QDateTime>() method -------------------------------------------------------------
@@ -862,6 +968,69 @@ void TestSerialization::testSerializeQDateTime_data()
     QTest::newRow("2020-08-05T12:34:56.789Z")
             << QDateTime(QDate(2020, 8, 5), QTime(12, 34, 56, 789), Qt::UTC)
             << QJsonValue("2020-08-05T12:34:56.789Z");
+    QTest::newRow("2020-08-05T12:34:56.789")
+            << QDateTime(QDate(2020, 8, 5), QTime(12, 34, 56, 789), Qt::LocalTime)
+            << QJsonValue("2020-08-05T12:34:56.789");
+    QTest::newRow("2020-08-05T12:34:56.789-05:30")
+            << QDateTime(QDate(2020, 8, 5), QTime(12, 34, 56, 789), Qt::OffsetFromUTC, -19800)
+            << QJsonValue("2020-08-05T12:34:56.789-05:30");
+}
+
+// Test: serialize() method with compact encoding --------------------------------------------------
+
+void TestSerialization::testSerializeCompactEncoding()
+{
+    QFETCH(QVariant, input);
+    QFETCH(QJsonValue, expectedResult);
+
+    const CedarFramework::EncodingScope scope(CedarFramework::EncodingProfile::compact());
+    const auto result = CedarFramework::serialize(input);
+    QCOMPARE(result, expectedResult);
+}
+
+void TestSerialization::testSerializeCompactEncoding_data()
+{
+    QTest::addColumn<QVariant>("input");
+    QTest::addColumn<QJsonValue>("expectedResult");
+
+    QTest::newRow("QDate: empty") << QVariant(QDate()) << QJsonValue("");
+    QTest::newRow("QDate: 2020-08-05") << QVariant(QDate(2020, 8, 5)) << QJsonValue(2459067);
+
+    QTest::newRow("QTime: empty") << QVariant(QTime()) << QJsonValue("");
+    QTest::newRow("QTime: 12:34:56.789")
+            << QVariant(QTime(12, 34, 56, 789)) << QJsonValue(45296789);
+
+    QTest::newRow("QDateTime: empty") << QVariant(QDateTime()) << QJsonValue("");
+    QTest::newRow("QDateTime: local time")
+            << QVariant(QDateTime::fromMSecsSinceEpoch(1596630896789LL))
+            << QJsonValue(1596630896789.0);
+    QTest::newRow("QDateTime: 2020-08-05T12:34:56.789Z")
+            << QVariant(QDateTime(QDate(2020, 8, 5), QTime(12, 34, 56, 789), Qt::UTC))
+            << QJsonValue(QJsonArray { 1596630896789.0, 0 });
+    QTest::newRow("QDateTime: 2020-08-05T14:34:56.789+02:00")
+            << QVariant(QDateTime(
+                            QDate(2020, 8, 5), QTime(14, 34, 56, 789), Qt::OffsetFromUTC, 7200))
+            << QJsonValue(QJsonArray { 1596630896789.0, 7200 });
+
+    QTest::newRow("QUuid: null")
+            << QVariant::fromValue(QUuid()) << QJsonValue("AAAAAAAAAAAAAAAAAAAAAA");
+    QTest::newRow("QUuid: {01234567-89ab-cdef-0123-456789abcdef}")
+            << QVariant::fromValue(QUuid("{01234567-89ab-cdef-0123-456789abcdef}"))
+            << QJsonValue("ASNFZ4mrze8BI0VniavN7w");
+
+    QTest::newRow("QSize") << QVariant(QSize(1, 2)) << QJsonValue(QJsonArray { 1, 2 });
+    QTest::newRow("QSizeF") << QVariant(QSizeF(1.5, 2.5)) << QJsonValue(QJsonArray { 1.5, 2.5 });
+    QTest::newRow("QPoint") << QVariant(QPoint(1, 2)) << QJsonValue(QJsonArray { 1, 2 });
+    QTest::newRow("QPointF")
+            << QVariant(QPointF(1.5, 2.5)) << QJsonValue(QJsonArray { 1.5, 2.5 });
+    QTest::newRow("QLine") << QVariant(QLine(1, 2, 3, 4)) << QJsonValue(QJsonArray { 1, 2, 3, 4 });
+    QTest::newRow("QLineF")
+            << QVariant(QLineF(1.5, 2.5, 3.5, 4.5))
+            << QJsonValue(QJsonArray { 1.5, 2.5, 3.5, 4.5 });
+    QTest::newRow("QRect") << QVariant(QRect(1, 2, 3, 4)) << QJsonValue(QJsonArray { 1, 2, 3, 4 });
+    QTest::newRow("QRectF")
+            << QVariant(QRectF(1.5, 2.5, 3.5, 4.5))
+            << QJsonValue(QJsonArray { 1.5, 2.5, 3.5, 4.5 });
 }
 
 // Test: serialize<QVariant>() method --------------------------------------------------------------
@@ -2045,6 +2214,27 @@ void TestSerialization::testSerializeStdPair_data()
     }
 }
 
+// Test: serialize<std::pair>() method with compact encoding ---------------------------------------
+
+void TestSerialization::testSerializeStdPairCompact()
+{
+    QFETCH(StdPairStringInt, input);
+    QFETCH(QJsonValue, expectedResult);
+
+    const auto result = CedarFramework::serialize(input,
+                                                  CedarFramework::EncodingProfile::compact());
+    QCOMPARE(result, expectedResult);
+}
+
+void TestSerialization::testSerializeStdPairCompact_data()
+{
+    QTest::addColumn<StdPairStringInt>("input");
+    QTest::addColumn<QJsonValue>("expectedResult");
+
+    QTest::newRow("1") << StdPairStringInt("asd", 123) << QJsonValue(QJsonArray { "asd", 123 });
+    QTest::newRow("2") << StdPairStringInt("abc", 456) << QJsonValue(QJsonArray { "abc", 456 });
+}
+
 // Test: serialize<QList>() method -----------------------------------------------------------
 
 void TestSerialization::testSerializeQList()
@@ -2196,6 +2386,117 @@ void TestSerialization::testSerializeQSet_data()
     }
 }
 
+// Test: serialize<QVarLengthArray>() method -------------------------------------------------------
+
+void TestSerialization::testSerializeQVarLengthArray()
+{
+    QFETCH(QVector<int>, input);
+    QFETCH(QJsonValue, expectedResult);
+
+    QVarLengthArray<int, 4> container;
+
+    for (const int item : input)
+    {
+        container.append(item);
+    }
+
+    QCOMPARE(CedarFramework::serialize(container), expectedResult);
+}
+
+void TestSerialization::testSerializeQVarLengthArray_data()
+{
+    QTest::addColumn<QVector<int>>("input");
+    QTest::addColumn<QJsonValue>("expectedResult");
+
+    QTest::newRow("empty") << QVector<int>() << QJsonValue(QJsonArray());
+    QTest::newRow("non-empty") << QVector<int> { 1, 2, 3 } << QJsonValue(QJsonArray { 1, 2, 3 });
+    QTest::newRow("heap")
+            << QVector<int> { 1, 2, 3, 4, 5 } << QJsonValue(QJsonArray { 1, 2, 3, 4, 5 });
+}
+
+// Test: serialize<std::deque>() method ------------------------------------------------------------
+
+void TestSerialization::testSerializeStdDeque()
+{
+    QFETCH(QVector<int>, input);
+    QFETCH(QJsonValue, expectedResult);
+
+    const std::deque<int> container(input.begin(), input.end());
+    QCOMPARE(CedarFramework::serialize(container), expectedResult);
+}
+
+void TestSerialization::testSerializeStdDeque_data()
+{
+    QTest::addColumn<QVector<int>>("input");
+    QTest::addColumn<QJsonValue>("expectedResult");
+
+    QTest::newRow("empty") << QVector<int>() << QJsonValue(QJsonArray());
+    QTest::newRow("non-empty") << QVector<int> { 1, 2, 3 } << QJsonValue(QJsonArray { 1, 2, 3 });
+}
+
+// Test: serialize<std::array>() method ------------------------------------------------------------
+
+void TestSerialization::testSerializeStdArray()
+{
+    const std::array<int, 0> emptyInput {};
+    QCOMPARE(CedarFramework::serialize(emptyInput), QJsonValue(QJsonArray()));
+
+    const std::array<double, 3> input { { 1.5, 2.5, 3.5 } };
+    QCOMPARE(CedarFramework::serialize(input), QJsonValue(QJsonArray { 1.5, 2.5, 3.5 }));
+}
+
+// Test: serialize<std::set>() method --------------------------------------------------------------
+
+void TestSerialization::testSerializeStdSet()
+{
+    QFETCH(QVector<int>, input);
+    QFETCH(QJsonValue, expectedResult);
+
+    const std::set<int> container(input.begin(), input.end());
+    QCOMPARE(CedarFramework::serialize(container), expectedResult);
+}
+
+void TestSerialization::testSerializeStdSet_data()
+{
+    QTest::addColumn<QVector<int>>("input");
+    QTest::addColumn<QJsonValue>("expectedResult");
+
+    QTest::newRow("empty") << QVector<int>() << QJsonValue(QJsonArray());
+    QTest::newRow("non-empty") << QVector<int> { 1, -1, 0 } << QJsonValue(QJsonArray { -1, 0, 1 });
+}
+
+// Test: serialize<std::unordered_set>() method ----------------------------------------------------
+
+void TestSerialization::testSerializeStdUnorderedSet()
+{
+    QFETCH(QVector<int>, input);
+    QFETCH(QJsonValue, expectedResult);
+
+    const std::unordered_set<int> container(input.begin(), input.end());
+    const auto result = CedarFramework::serialize(container);
+    QVERIFY(result.isArray());
+    QVERIFY(expectedResult.isArray());
+
+    const auto resultArray = result.toArray();
+    const auto expectedResultArray = expectedResult.toArray();
+
+    QCOMPARE(resultArray.size(), expectedResultArray.size());
+
+    for (const auto &resultItem : resultArray)
+    {
+        QVERIFY(expectedResultArray.contains(resultItem));
+    }
+}
+
+void TestSerialization::testSerializeStdUnorderedSet_data()
+{
+    QTest::addColumn<QVector<int>>("input");
+    QTest::addColumn<QJsonValue>("expectedResult");
+
+    QTest::newRow("empty") << QVector<int>() << QJsonValue(QJsonArray());
+    QTest::newRow("non-empty") << QVector<int> { 1, -1, 0 } << QJsonValue(QJsonArray { -1, 0, 1 });
+}
+
 // Test: serialize<QMap>() method -----------------------------------------------------------
 
 using QMapVariantVariant = QMap<QVariant, QVariant>;
@@ -2369,6 +2670,22 @@ void TestSerialization::testSerializeStdUnorderedMap_data()
         QTest::newRow("non-empty") << input << QJsonValue(expectedResult);
     }
 
+    {
+        const StdUnorderedMapIntVariant input
+        {
+            { std::numeric_limits<int>::lowest(), "a" },
+            { 1234567,                            "b" },
+            { std::numeric_limits<int>::max(),    "c" }
+        };
+        const QJsonObject expectedResult
+        {
+            { "-2147483648", "a" },
+            {     "1234567", "b" },
+            {  "2147483647", "c" }
+        };
+        QTest::newRow("non-empty: large keys") << input << QJsonValue(expectedResult);
+    }
+
     {
         const StdUnorderedMapIntVariant input { { 0, QVariant(QVariant::Invalid) } };
         QTest::newRow("invalid value") << input << QJsonValue(QJsonValue::Undefined);
@@ -2427,6 +2744,11 @@ void TestSerialization::testSerializeQMultiMap_data()
         const QMultiMapVariantVariant input { { 0, QVariant(QVariant::Invalid) } };
         QTest::newRow("invalid value") << input << QJsonValue(QJsonValue::Undefined);
     }
+
+    {
+        const QMultiMapVariantVariant input { { 0, "a" }, { 0, QVariant(QVariant::Invalid) } };
+        QTest::newRow("invalid second value") << input << QJsonValue(QJsonValue::Undefined);
+    }
 }
 
 // Test: serialize<QMultiHash>() method -----------------------------------------------------------
@@ -2478,6 +2800,293 @@ void TestSerialization::testSerializeQMultiHash_data()
     }
 }
 
+// Test: inline overloads --------------------------------------------------------------------------
+
+void TestSerialization::testInlineOverloads()
+{
+    // Inline overloads need to give the same result as the exported specializations
+    const long long largeValue = 9007199254740993LL;
+    const unsigned long long maxValue = std::numeric_limits<unsigned long long>::max();
+
+    QCOMPARE(CedarFramework::serialize(true), CedarFramework::serialize<bool>(true));
+    QCOMPARE(CedarFramework::serialize(-1), CedarFramework::serialize<int>(-1));
+    QCOMPARE(CedarFramework::serialize(4294967295U),
+             CedarFramework::serialize<unsigned int>(4294967295U));
+    QCOMPARE(CedarFramework::serialize(largeValue),
+             CedarFramework::serialize<long long>(largeValue));
+    QCOMPARE(CedarFramework::serialize(maxValue),
+             CedarFramework::serialize<unsigned long long>(maxValue));
+    QCOMPARE(CedarFramework::serialize(2.5F), CedarFramework::serialize<float>(2.5F));
+    QCOMPARE(CedarFramework::serialize(2.5), CedarFramework::serialize<double>(2.5));
+    QCOMPARE(CedarFramework::serialize(QChar('a')), CedarFramework::serialize<QChar>(QChar('a')));
+    QCOMPARE(CedarFramework::serialize(QString("a")),
+             CedarFramework::serialize<QString>(QString("a")));
+}
+
+// Test: JsonObjectBuilder -------------------------------------------------------------------------
+
+void TestSerialization::testJsonObjectBuilder()
+{
+    CedarFramework::JsonObjectBuilder builder(4);
+    builder.insert("b", 2);
+    builder.insert("c", 3);
+    builder.insert("a", 1);
+    builder.insert("b", 4);
+
+    const QJsonObject expectedResult { { "a", 1 }, { "b", 4 }, { "c", 3 } };
+    QCOMPARE(builder.toObject(), expectedResult);
+
+    // Builder is empty after the object is constructed
+    QCOMPARE(builder.toObject(), QJsonObject());
+}
+
+// Benchmark: serialize<std::vector<int>>() method -------------------------------------------------
+
+void TestSerialization::benchmarkSerializeStdVectorInt()
+{
+    std::vector<int> input(10000);
+
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<int>(i);
+    }
+
+    QJsonValue output;
+
+    QBENCHMARK
+    {
+        output = CedarFramework::serialize(input);
+    }
+
+    QCOMPARE(output.toArray().size(), static_cast<int>(input.size()));
+}
+
+// Benchmark: serialize<QVector<double>>() method --------------------------------------------------
+
+void TestSerialization::benchmarkSerializeQVectorDouble()
+{
+    QVector<double> input(10000);
+
+    for (int i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<double>(i) / 4.0;
+    }
+
+    QJsonValue output;
+
+    QBENCHMARK
+    {
+        output = CedarFramework::serialize(input);
+    }
+
+    QCOMPARE(output.toArray().size(), input.size());
+}
+
+// Benchmark: serialize<QMultiMap>() method --------------------------------------------------------
+
+void TestSerialization::benchmarkSerializeQMultiMap()
+{
+    QMultiMap<int, int> input;
+
+    for (int i = 0; i < 100000; i++)
+    {
+        input.insert(i / 10, i);
+    }
+
+    QJsonValue output;
+
+    QBENCHMARK
+    {
+        output = CedarFramework::serialize(input);
+    }
+
+    QCOMPARE(output.toObject().size(), input.uniqueKeys().size());
+}
+
+// Benchmark: serialize<QHash>() method ------------------------------------------------------------
+
+void TestSerialization::benchmarkSerializeQHash()
+{
+    QHash<int, int> input;
+    input.reserve(200000);
+
+    for (int i = 0; i < 200000; i++)
+    {
+        input.insert(i, i);
+    }
+
+    QJsonValue output;
+
+    QBENCHMARK
+    {
+        output = CedarFramework::serialize(input);
+    }
+
+    QCOMPARE(output.toObject().size(), input.size());
+}
+
+// Benchmark: serialize<QByteArray>() method -------------------------------------------------------
+
+void TestSerialization::benchmarkSerializeQByteArray()
+{
+    QFETCH(int, size);
+
+    QByteArray input(size, Qt::Uninitialized);
+
+    for (int i = 0; i < size; i++)
+    {
+        input[i] = static_cast<char>(i * 7);
+    }
+
+    QJsonValue output;
+
+    QBENCHMARK
+    {
+        output = CedarFramework::serialize(input);
+    }
+
+    QCOMPARE(output.toString().size(), ((size + 2) / 3) * 4);
+}
+
+void TestSerialization::benchmarkSerializeQByteArray_data()
+{
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("1 KB") << 1024;
+    QTest::newRow("64 KB") << 64 * 1024;
+    QTest::newRow("1 MB") << 1024 * 1024;
+    QTest::newRow("64 MB") << 64 * 1024 * 1024;
+}
+
+// Benchmark: serialize<std::string>() method ------------------------------------------------------
+
+void TestSerialization::benchmarkSerializeStdString()
+{
+    std::string input;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        input += u8"Lorem ipsum dolor sit amet, consectetur adipiscing elit \u00e9\u20ac\n";
+    }
+
+    QJsonValue output;
+
+    QBENCHMARK
+    {
+        output = CedarFramework::serialize(input);
+    }
+
+    QCOMPARE(output.toString().size(), 10000 * 59);
+}
+
+// Benchmark: serialize() method with the containers instantiated in the library -------------------
+
+template<typename T>
+T createBenchmarkItem(int index);
+
+template<>
+int createBenchmarkItem(int index)
+{
+    return index;
+}
+
+template<>
+double createBenchmarkItem(int index)
+{
+    return static_cast<double>(index) / 4.0;
+}
+
+template<>
+QString createBenchmarkItem(int index)
+{
+    return QString::number(index);
+}
+
+template<>
+QVariant createBenchmarkItem(int index)
+{
+    return QVariant(index);
+}
+
+template<typename C>
+void benchmarkSerializeSequenceContainer()
+{
+    C input;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        input.push_back(createBenchmarkItem<typename C::value_type>(i));
+    }
+
+    QJsonValue output;
+
+    QBENCHMARK
+    {
+        output = CedarFramework::serialize(input);
+    }
+
+    QCOMPARE(output.toArray().size(), 10000);
+}
+
+template<typename C>
+void benchmarkSerializeMapContainer()
+{
+    C input;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        input.insert(QString::number(i), createBenchmarkItem<typename C::mapped_type>(i));
+    }
+
+    QJsonValue output;
+
+    QBENCHMARK
+    {
+        output = CedarFramework::serialize(input);
+    }
+
+    QCOMPARE(output.toObject().size(), 10000);
+}
+
+using ContainerBenchmark = void (*)();
+Q_DECLARE_METATYPE(ContainerBenchmark)
+
+void TestSerialization::benchmarkSerializeInstantiatedContainers()
+{
+    QFETCH(ContainerBenchmark, benchmark);
+
+    benchmark();
+}
+
+void TestSerialization::benchmarkSerializeInstantiatedContainers_data()
+{
+    QTest::addColumn<ContainerBenchmark>("benchmark");
+
+    QTest::newRow("QList<int>") << &benchmarkSerializeSequenceContainer<QList<int>>;
+    QTest::newRow("QList<double>") << &benchmarkSerializeSequenceContainer<QList<double>>;
+    QTest::newRow("QList<QString>") << &benchmarkSerializeSequenceContainer<QList<QString>>;
+    QTest::newRow("QList<QVariant>") << &benchmarkSerializeSequenceContainer<QList<QVariant>>;
+    QTest::newRow("QVector<int>") << &benchmarkSerializeSequenceContainer<QVector<int>>;
+    QTest::newRow("QVector<double>") << &benchmarkSerializeSequenceContainer<QVector<double>>;
+    QTest::newRow("QVector<QString>") << &benchmarkSerializeSequenceContainer<QVector<QString>>;
+    QTest::newRow("std::vector<int>") << &benchmarkSerializeSequenceContainer<std::vector<int>>;
+    QTest::newRow("std::vector<double>")
+            << &benchmarkSerializeSequenceContainer<std::vector<double>>;
+    QTest::newRow("std::vector<QString>")
+            << &benchmarkSerializeSequenceContainer<std::vector<QString>>;
+    QTest::newRow("QMap<QString, int>") << &benchmarkSerializeMapContainer<QMap<QString, int>>;
+    QTest::newRow("QMap<QString, double>")
+            << &benchmarkSerializeMapContainer<QMap<QString, double>>;
+    QTest::newRow("QMap<QString, QString>")
+            << &benchmarkSerializeMapContainer<QMap<QString, QString>>;
+    QTest::newRow("QMap<QString, QVariant>")
+            << &benchmarkSerializeMapContainer<QMap<QString, QVariant>>;
+    QTest::newRow("QHash<QString, QString>")
+            << &benchmarkSerializeMapContainer<QHash<QString, QString>>;
+    QTest::newRow("QHash<QString, QVariant>")
+            << &benchmarkSerializeMapContainer<QHash<QString, QVariant>>;
+}
+
 // Main function -----------------------------------------------------------------------------------
 
 QTEST_MAIN(TestSerialization)
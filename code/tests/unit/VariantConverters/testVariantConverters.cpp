@@ -0,0 +1,300 @@
+/* This file is part of Cedar Framework.
+ *
+ * Cedar Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Cedar Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with Cedar
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for the registry of QVariant converters
+ */
+
+// Cedar Framework includes
+#include <CedarFramework/VariantConverters.hpp>
+
+// Qt includes
+#include <QtCore/QDateTime>
+#include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonValue>
+#include <QtCore/QSize>
+#include <QtCore/QUuid>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test types --------------------------------------------------------------------------------------
+
+namespace Test
+{
+
+struct Temperature
+{
+    double celsius = 0.0;
+};
+
+} // namespace Test
+
+Q_DECLARE_METATYPE(Test::Temperature)
+
+namespace CedarFramework
+{
+
+template<>
+QJsonValue serialize(const Test::Temperature &value)
+{
+    return serialize(value.celsius);
+}
+
+template<>
+bool deserialize(const QJsonValue &json, Test::Temperature *value)
+{
+    return deserialize(json, &value->celsius);
+}
+
+} // namespace CedarFramework
+
+// Test class declaration --------------------------------------------------------------------------
+
+class TestVariantConverters : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testTypedVariantRoundTrip();
+    void testTypedVariantRoundTrip_data();
+
+    void testDeserializeTypedVariant();
+    void testDeserializeTypedVariant_data();
+
+    void testRegisterVariantConverter();
+
+    // Benchmarks
+    void benchmarkSerializeVariantList();
+    void benchmarkSerializeTypedVariantList();
+    void benchmarkDeserializeTypedVariantList();
+
+private:
+    static QVariantList heterogeneousList();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestVariantConverters::initTestCase()
+{
+}
+
+void TestVariantConverters::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestVariantConverters::init()
+{
+}
+
+void TestVariantConverters::cleanup()
+{
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+QVariantList TestVariantConverters::heterogeneousList()
+{
+    QVariantList list;
+
+    for (int i = 0; i < 100; i++)
+    {
+        list << QVariant(i)
+             << QVariant(static_cast<double>(i) / 4.0)
+             << QVariant(QString::number(i))
+             << QVariant(QDate(2020, 1, 1).addDays(i))
+             << QVariant(QSize(i, i))
+             << QVariant(QVariantMap { { "a", i }, { "b", true } });
+    }
+
+    return list;
+}
+
+// Test: serializeTypedVariant() and deserializeTypedVariant() methods -----------------------------
+
+void TestVariantConverters::testTypedVariantRoundTrip()
+{
+    QFETCH(QVariant, input);
+
+    const QJsonValue serializedValue = CedarFramework::serializeTypedVariant(input);
+    QVERIFY(!serializedValue.isUndefined());
+
+    QVariant output;
+    QVERIFY(CedarFramework::deserializeTypedVariant(serializedValue, &output));
+    QCOMPARE(output.userType(), input.userType());
+    QCOMPARE(output, input);
+}
+
+void TestVariantConverters::testTypedVariantRoundTrip_data()
+{
+    QTest::addColumn<QVariant>("input");
+
+    QTest::newRow("invalid") << QVariant();
+    QTest::newRow("nullptr") << QVariant::fromValue(nullptr);
+    QTest::newRow("bool") << QVariant(true);
+    QTest::newRow("short") << QVariant::fromValue<short>(-2);
+    QTest::newRow("int") << QVariant(1);
+    QTest::newRow("uint") << QVariant(1U);
+    QTest::newRow("long long") << QVariant(1234567890123LL);
+    QTest::newRow("float") << QVariant(2.5F);
+    QTest::newRow("double") << QVariant(2.5);
+    QTest::newRow("QString") << QVariant(QString("a"));
+    QTest::newRow("QDate") << QVariant(QDate(2020, 1, 2));
+    QTest::newRow("QUuid") << QVariant(QUuid::createUuid());
+    QTest::newRow("QSize") << QVariant(QSize(1, 2));
+    QTest::newRow("QStringList") << QVariant(QStringList { "a", "b" });
+    QTest::newRow("QVariantList")
+            << QVariant(QVariantList {
+                            1, 2.5F, QString("a"), QDate(2020, 1, 2), QVariantList { 1U }
+                        });
+    QTest::newRow("QVariantMap")
+            << QVariant(QVariantMap { { "a", 1 }, { "b", QSize(1, 2) } });
+}
+
+// Test: deserializeTypedVariant() method ----------------------------------------------------------
+
+void TestVariantConverters::testDeserializeTypedVariant()
+{
+    QFETCH(QJsonValue, input);
+    QFETCH(bool, expectedResult);
+
+    QVariant output;
+    QCOMPARE(CedarFramework::deserializeTypedVariant(input, &output), expectedResult);
+}
+
+void TestVariantConverters::testDeserializeTypedVariant_data()
+{
+    QTest::addColumn<QJsonValue>("input");
+    QTest::addColumn<bool>("expectedResult");
+
+    // Positive tests
+    QTest::newRow("Null") << QJsonValue() << true;
+    QTest::newRow("int")
+            << QJsonValue(QJsonObject { { "type", "int" }, { "value", 1 } })
+            << true;
+    QTest::newRow("typedef name")
+            << QJsonValue(QJsonObject { { "type", "qlonglong" }, { "value", 1 } })
+            << true;
+    QTest::newRow("alias of a variant container")
+            << QJsonValue(QJsonObject { { "type", "QList<QVariant>" }, { "value", QJsonArray() } })
+            << true;
+
+    // Negative tests
+    QTest::newRow("Bool") << QJsonValue(true) << false;
+    QTest::newRow("Array") << QJsonValue(QJsonArray { "int", 1 }) << false;
+    QTest::newRow("missing value") << QJsonValue(QJsonObject { { "type", "int" } }) << false;
+    QTest::newRow("invalid type name")
+            << QJsonValue(QJsonObject { { "type", 1 }, { "value", 1 } })
+            << false;
+    QTest::newRow("unknown type")
+            << QJsonValue(QJsonObject { { "type", "Unknown" }, { "value", 1 } })
+            << false;
+    QTest::newRow("invalid value")
+            << QJsonValue(QJsonObject { { "type", "int" }, { "value", "a" } })
+            << false;
+}
+
+// Test: registerVariantConverter() method ---------------------------------------------------------
+
+void TestVariantConverters::testRegisterVariantConverter()
+{
+    const int typeId = qRegisterMetaType<Test::Temperature>();
+    Test::Temperature temperature;
+    temperature.celsius = 21.5;
+
+    QVERIFY(CedarFramework::hasVariantConverter(QMetaType::Int));
+    QVERIFY(!CedarFramework::hasVariantConverter(typeId));
+    QVERIFY(CedarFramework::serialize(QVariant::fromValue(temperature)).isUndefined());
+
+    CedarFramework::registerVariantConverter<Test::Temperature>();
+    QVERIFY(CedarFramework::hasVariantConverter(typeId));
+
+    const QJsonValue serializedValue =
+            CedarFramework::serializeTypedVariant(QVariant::fromValue(temperature));
+    QCOMPARE(serializedValue,
+             QJsonValue(QJsonObject { { "type", "Test::Temperature" }, { "value", 21.5 } }));
+
+    QVariant output;
+    QVERIFY(CedarFramework::deserializeTypedVariant(serializedValue, &output));
+    QCOMPARE(output.userType(), typeId);
+    QCOMPARE(output.value<Test::Temperature>().celsius, 21.5);
+
+    // Without the typed encoding the type that the output already holds is not used
+    QVariant existingOutput = QVariant::fromValue(Test::Temperature());
+    QVERIFY(CedarFramework::deserialize(QJsonValue(-3.5), &existingOutput));
+    QCOMPARE(existingOutput, QVariant(-3.5));
+}
+
+// Benchmark: serialize(QVariantList) method -------------------------------------------------------
+
+void TestVariantConverters::benchmarkSerializeVariantList()
+{
+    const QVariant input = heterogeneousList();
+
+    QBENCHMARK
+    {
+        CedarFramework::serialize(input);
+    }
+}
+
+// Benchmark: serializeTypedVariant(QVariantList) method -------------------------------------------
+
+void TestVariantConverters::benchmarkSerializeTypedVariantList()
+{
+    const QVariant input = heterogeneousList();
+
+    QBENCHMARK
+    {
+        CedarFramework::serializeTypedVariant(input);
+    }
+}
+
+// Benchmark: deserializeTypedVariant(QVariantList) method -----------------------------------------
+
+void TestVariantConverters::benchmarkDeserializeTypedVariantList()
+{
+    const QJsonValue input = CedarFramework::serializeTypedVariant(heterogeneousList());
+    QVariant output;
+
+    QBENCHMARK
+    {
+        CedarFramework::deserializeTypedVariant(input, &output);
+    }
+
+    QCOMPARE(output, QVariant(heterogeneousList()));
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestVariantConverters)
+#include "testVariantConverters.moc"